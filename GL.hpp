@@ -8,4 +8,9 @@
 #else
 #define GL_GLEXT_PROTOTYPES 1
 #include "glcorearb.h"
+#ifdef GL_STATS
+//count calls through gl_stats.cpp:
+#include "gl_stats.hpp"
+#include "gl_dispatch.hpp"
+#endif
 #endif
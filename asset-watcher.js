@@ -3,13 +3,25 @@
 "use strict";
 
 const fs = require("fs");
+const os = require("os");
 const path = require("path");
 const { exec } = require("child_process");
+const { Worker, isMainThread, parentPort, workerData } = require("worker_threads");
+
+// the ".font" handler runs distance transforms on worker threads, which load this same script:
+if (!isMainThread) {
+  parentPort.postMessage(workerData.glyphs.map(rows => distanceField(rows, workerData.layout)));
+  return;
+}
 
 const cwd = process.cwd();
-const directories = process.argv.slice(2).map(filepath => path.resolve(cwd, filepath));
+const paths = process.argv.slice(2).map(filepath => path.resolve(cwd, filepath));
+
+// files given on the command line are processed once; directories are watched
+const files = paths.filter(filepath => fs.statSync(filepath).isFile());
+const directories = paths.filter(filepath => !files.includes(filepath));
 
-if (!directories.length) {
+if (!paths.length) {
   directories.push(path.resolve(cwd, "."));
 }
 
@@ -111,9 +123,485 @@ const onChange = {
         console.log("Done\n");
       });
     });
+  },
+  ".font": ({ fullpath, directory, name }) => {
+    // Compiles ASCII-art glyphs into a signed distance field atlas: 'name'.png holds the
+    // field in alpha (0.5 on the outline) and 'name'.sdf is the glyph table read by
+    // load_sdf_font() (see sdf_font.hpp): "sdf0", a glyph count, then per glyph the
+    // character code and the min and max uv of its cell.
+    fs.readFile(fullpath, (err, data) => {
+      if (err) {
+        console.error(err);
+        return;
+      }
+
+      const glyphs = [];
+      data
+        .toString()
+        .split(/\n/)
+        .forEach((line, index) => {
+          const declared = line.match(/^glyph (\S+)$/);
+          if (declared) {
+            const code = declared[1] === "space" ? 32 : declared[1].charCodeAt(0);
+            if (declared[1] !== "space" && declared[1].length !== 1) {
+              throw new Error(`${fullpath}:${index + 1}: expected one character or 'space'`);
+            }
+            glyphs.push({ code, rows: [] });
+          } else if (/^[#.]+$/.test(line) && glyphs.length) {
+            glyphs[glyphs.length - 1].rows.push(line);
+          }
+        });
+
+      // cells match the atlas letter sprites; the field extends 'spread' font pixels past them:
+      const layout = { cell: [6, 7], scale: 8, spread: 1 };
+      const tile = layout.cell.map(size => (size + 2 * layout.spread) * layout.scale);
+      const columns = 8;
+      const width = columns * tile[0];
+      const height = Math.ceil(glyphs.length / columns) * tile[1];
+
+      // split the glyphs over one worker per core:
+      const threads = Math.max(1, Math.min(os.cpus().length, glyphs.length));
+      const jobs = [];
+      for (let t = 0; t < threads; ++t) {
+        const first = Math.floor((glyphs.length * t) / threads);
+        const last = Math.floor((glyphs.length * (t + 1)) / threads);
+        jobs.push(
+          new Promise((resolve, reject) => {
+            const worker = new Worker(__filename, {
+              workerData: { glyphs: glyphs.slice(first, last).map(glyph => glyph.rows), layout }
+            });
+            worker.once("message", fields => resolve({ first, fields }));
+            worker.once("error", reject);
+          })
+        );
+      }
+
+      Promise.all(jobs)
+        .then(results => {
+          const pixels = Buffer.alloc(width * height * 4);
+          const table = Buffer.alloc(8 + glyphs.length * 20);
+          let offset = table.write("sdf0", 0, "ascii");
+          offset = table.writeUInt32LE(glyphs.length, offset);
+
+          results.forEach(({ first, fields }) =>
+            fields.forEach((field, i) => {
+              const index = first + i;
+              const x0 = (index % columns) * tile[0];
+              const y0 = Math.floor(index / columns) * tile[1];
+              for (let y = 0; y < tile[1]; ++y) {
+                for (let x = 0; x < tile[0]; ++x) {
+                  const at = ((y0 + y) * width + x0 + x) * 4;
+                  pixels.fill(0xff, at, at + 3);
+                  pixels[at + 3] = field[y * tile[0] + x];
+                }
+              }
+
+              // uvs of the cell inside the tile, with v up (images load with a lower left origin):
+              const margin = layout.spread * layout.scale;
+              offset = table.writeUInt32LE(glyphs[index].code, offset);
+              offset = table.writeFloatLE((x0 + margin) / width, offset);
+              offset = table.writeFloatLE(1 - (y0 + tile[1] - margin) / height, offset);
+              offset = table.writeFloatLE((x0 + tile[0] - margin) / width, offset);
+              offset = table.writeFloatLE(1 - (y0 + margin) / height, offset);
+            })
+          );
+
+          fs.writeFileSync(path.resolve(directory, name) + ".png", encodePng(width, height, pixels));
+          fs.writeFileSync(path.resolve(directory, name) + ".sdf", table);
+          console.log(`Wrote ${glyphs.length} glyphs (${width}x${height}) using ${threads} thread(s).`);
+          console.log("Done\n");
+        })
+        .catch(err => console.error(err));
+    });
+  },
+  ".level": ({ fullpath, directory, name }) => {
+    // Compiles a text level into the binary layout read by load_level() (see level.hpp):
+    // a 56 byte header, then the region, box, item, prop, volume, hint, recipe and tile layer
+    // arrays, then the uint16 tiles, then a table of null-terminated strings.
+    // Every record is made of 4 byte fields.
+    fs.readFile(fullpath, (err, data) => {
+      if (err) {
+        console.error(err);
+        return;
+      }
+
+      const strings = [""];
+      const stringOffsets = { "": 0 };
+      let stringBytes = 1;
+      const string = value => {
+        if (!(value in stringOffsets)) {
+          stringOffsets[value] = stringBytes;
+          strings.push(value);
+          stringBytes += Buffer.byteLength(value) + 1;
+        }
+        return stringOffsets[value];
+      };
+
+      let sprites = {};
+      let flags = {};
+      let start = null;
+      const regions = [];
+      const records = { box: [], item: [], prop: [], volume: [], hint: [], recipe: [], tiles: [] };
+      const tiles = [];
+
+      const fail = (lineNumber, message) => {
+        throw new Error(`${fullpath}:${lineNumber}: ${message}`);
+      };
+
+      data
+        .toString()
+        .split(/\n/)
+        .forEach((line, index) => {
+          const lineNumber = index + 1;
+          const tokens = (line.replace(/#[^"]*$/, "").match(/"[^"]*"|\S+/g) || []).map(token =>
+            token.replace(/^"|"$/g, "")
+          );
+          if (!tokens.length) {
+            return;
+          }
+
+          const sprite = token => {
+            if (!(token in sprites)) fail(lineNumber, `unknown sprite '${token}'`);
+            return sprites[token];
+          };
+          const region = token => {
+            const found = regions.findIndex(r => r.name === token);
+            if (found === -1) fail(lineNumber, `unknown region '${token}'`);
+            return found;
+          };
+          const workbench = token =>
+            token === "-"
+              ? 0
+              : token.split("+").reduce((bits, flag) => {
+                  if (!(flag in flags)) fail(lineNumber, `unknown flag '${flag}'`);
+                  return bits | flags[flag];
+                }, 0);
+          const numbers = values => values.map(value => {
+            if (isNaN(parseFloat(value))) fail(lineNumber, `expected a number, got '${value}'`);
+            return parseFloat(value);
+          });
+
+          const [kind, ...args] = tokens;
+          switch (kind) {
+            case "atlas":
+              // sprite names are the labels of the atlas .info file, in line order:
+              sprites = {};
+              fs.readFileSync(path.resolve(directory, args[0]))
+                .toString()
+                .split(/\n/)
+                .forEach((info, i) => {
+                  const label = info.match(/^\s*([^:\s]+):/);
+                  if (label) sprites[label[1].toLowerCase()] = i;
+                });
+              break;
+            case "flags":
+              flags = {};
+              args.forEach((flag, bit) => (flags[flag] = 1 << bit));
+              break;
+            case "start":
+              start = { name: args[0], at: numbers(args.slice(1, 3)), line: lineNumber };
+              break;
+            case "region":
+              regions.push({
+                name: args[0],
+                label: string(args[0]),
+                sprite: args[1] === "-" ? -1 : sprite(args[1]),
+                image: string(args[2] === "-" ? "" : args[2]),
+                left: args[3],
+                right: args[4],
+                radius: args.length > 5 ? numbers(args.slice(5, 7)) : [16.0, 12.0],
+                line: lineNumber
+              });
+              break;
+            case "box":
+              records.box.push({ region: region(args[0]), values: numbers(args.slice(1, 5)), name: string(args[5] || "") });
+              break;
+            case "item":
+              records.item.push({
+                region: region(args[0]),
+                name: string(args[1]),
+                sprite: sprite(args[2]),
+                values: numbers(args.slice(3, 8)),
+                adds: workbench(args[8]),
+                flags: args[9] === "spawned" ? 1 : 0
+              });
+              break;
+            case "prop":
+              records.prop.push({ region: region(args[0]), name: string(args[1]), sprite: sprite(args[2]), values: numbers(args.slice(3, 7)) });
+              break;
+            case "volume":
+              records.volume.push({
+                region: region(args[0]),
+                name: string(args[1]),
+                values: numbers(args.slice(2, 5)),
+                accepts: string(args[5] || ""),
+                display: numbers(args.slice(6, 8).concat(["0", "0"]).slice(0, 2))
+              });
+              break;
+            case "hint":
+              records.hint.push({ region: region(args[0]), values: numbers(args.slice(1, 4)), text: string(args[4]) });
+              break;
+            case "tiles": {
+              // tile indices come from a CSV (as exported by Tiled): top row first, -1 or blank for empty
+              const rows = fs
+                .readFileSync(path.resolve(directory, args[5]))
+                .toString()
+                .split(/\n/)
+                .filter(row => row.trim().length)
+                .map(row => row.split(",").map(value => (value.trim() === "" ? -1 : parseInt(value, 10))));
+              const width = Math.max(...rows.map(row => row.length));
+              const first = tiles.length;
+              rows.reverse().forEach(row => {
+                for (let x = 0; x < width; ++x) {
+                  const tile = x < row.length ? row[x] : -1;
+                  tiles.push(tile < 0 || isNaN(tile) ? 0xffff : tile);
+                }
+              });
+              records.tiles.push({
+                region: region(args[0]),
+                tileset: string(args[1]),
+                grid: numbers(args.slice(2, 4)),
+                size: [width, rows.length],
+                tileSize: numbers([args[4]])[0],
+                first
+              });
+              break;
+            }
+            case "recipe":
+              records.recipe.push({ result: sprite(args[0]), needs: workbench(args[1]), hint: string(args[2]) });
+              break;
+            default:
+              fail(lineNumber, `unknown record '${kind}'`);
+          }
+        });
+
+      if (!start) throw new Error(`${fullpath}: missing 'start' record`);
+      const neighbour = (token, line) => {
+        if (token === "-") return -1;
+        const found = regions.findIndex(r => r.name === token);
+        if (found === -1) fail(line, `unknown region '${token}'`);
+        return found;
+      };
+      const startRegion = neighbour(start.name, start.line);
+
+      // group records by region so each region owns a contiguous range of every array:
+      const ranges = regions.map(() => ({}));
+      ["box", "item", "prop", "volume", "hint"].forEach(kind => {
+        records[kind].sort((a, b) => a.region - b.region);
+        ranges.forEach((range, r) => {
+          const first = records[kind].findIndex(record => record.region === r);
+          const count = records[kind].filter(record => record.region === r).length;
+          range[kind] = [first === -1 ? 0 : first, count];
+        });
+      });
+
+      const HEADER_BYTES = 56;
+      const RECORD_BYTES = { region: 72, box: 24, item: 40, prop: 28, volume: 32, hint: 20, recipe: 12, tiles: 32 };
+      const out = Buffer.alloc(
+        HEADER_BYTES +
+          regions.length * RECORD_BYTES.region +
+          Object.keys(records).reduce((total, kind) => total + records[kind].length * RECORD_BYTES[kind], 0) +
+          tiles.length * 2 +
+          stringBytes
+      );
+
+      let offset = 0;
+      const u32 = value => (offset = out.writeUInt32LE(value >>> 0, offset));
+      const i32 = value => (offset = out.writeInt32LE(value, offset));
+      const f32 = value => (offset = out.writeFloatLE(value, offset));
+
+      out.write("lvl0", 0, "ascii");
+      offset = 4;
+      u32(startRegion);
+      start.at.forEach(f32);
+      [regions, records.box, records.item, records.prop, records.volume, records.hint, records.recipe, records.tiles].forEach(
+        array => u32(array.length)
+      );
+      u32(tiles.length);
+      u32(stringBytes);
+
+      regions.forEach((r, index) => {
+        u32(r.label);
+        u32(r.sprite);
+        u32(r.image);
+        r.radius.forEach(f32);
+        i32(neighbour(r.left, r.line));
+        i32(neighbour(r.right, r.line));
+        i32(records.tiles.findIndex(layer => layer.region === index));
+        ["box", "item", "prop", "volume", "hint"].forEach(kind => ranges[index][kind].forEach(u32));
+      });
+      records.box.forEach(b => {
+        u32(b.region);
+        u32(b.name);
+        b.values.forEach(f32);
+      });
+      records.item.forEach(i => {
+        u32(i.region);
+        u32(i.name);
+        u32(i.sprite);
+        u32(i.adds);
+        u32(i.flags);
+        i.values.forEach(f32);
+      });
+      records.prop.forEach(p => {
+        u32(p.region);
+        u32(p.name);
+        u32(p.sprite);
+        p.values.forEach(f32);
+      });
+      records.volume.forEach(v => {
+        u32(v.region);
+        u32(v.name);
+        u32(v.accepts);
+        v.values.forEach(f32);
+        v.display.forEach(f32);
+      });
+      records.hint.forEach(h => {
+        u32(h.region);
+        u32(h.text);
+        h.values.forEach(f32);
+      });
+      records.recipe.forEach(r => {
+        u32(r.needs);
+        u32(r.result);
+        u32(r.hint);
+      });
+      records.tiles.forEach(t => {
+        u32(t.region);
+        u32(t.tileset);
+        t.grid.forEach(u32);
+        t.size.forEach(u32);
+        f32(t.tileSize);
+        u32(t.first);
+      });
+      tiles.forEach(tile => (offset = out.writeUInt16LE(tile, offset)));
+      strings.forEach(value => {
+        offset += out.write(value, offset);
+        offset = out.writeUInt8(0, offset);
+      });
+
+      fs.writeFile(path.resolve(directory, name) + ".lvl", out, "binary", err => {
+        console.log("Done\n");
+      });
+    });
   }
 };
 
+// Signed distance field of one glyph tile (see the ".font" handler), as alpha bytes, top row first.
+// Ink is sampled at 'scale' texels per font pixel, then an exact Euclidean distance transform
+// (Felzenszwalb & Huttenlocher) runs once to the ink and once to the background.
+function distanceField(rows, { cell, scale, spread }) {
+  const width = (cell[0] + 2 * spread) * scale;
+  const height = (cell[1] + 2 * spread) * scale;
+  const glyphWidth = Math.max(...rows.map(row => row.length));
+  const left = spread + (cell[0] - glyphWidth) / 2;
+  const top = spread + (cell[1] - rows.length) / 2;
+
+  const ink = new Uint8Array(width * height);
+  for (let y = 0; y < height; ++y) {
+    const row = rows[Math.floor((y + 0.5) / scale - top)];
+    for (let x = 0; x < width; ++x) {
+      ink[y * width + x] = row && row[Math.floor((x + 0.5) / scale - left)] === "#" ? 1 : 0;
+    }
+  }
+
+  const toInk = squaredDistances(ink, width, height, 1);
+  const toBackground = squaredDistances(ink, width, height, 0);
+  const range = 2 * spread * scale;
+  const field = new Uint8Array(width * height);
+  for (let i = 0; i < field.length; ++i) {
+    // measured from texel centers, so the outline sits half a texel past the last ink texel:
+    const distance = ink[i] ? Math.sqrt(toBackground[i]) - 0.5 : 0.5 - Math.sqrt(toInk[i]);
+    field[i] = Math.round(255 * Math.min(1, Math.max(0, 0.5 + distance / range)));
+  }
+  return field;
+}
+
+// squared distance from every texel to the nearest texel whose 'mask' value is 'target':
+function squaredDistances(mask, width, height, target) {
+  const INF = 1e20;
+  const grid = new Float64Array(width * height);
+  for (let i = 0; i < grid.length; ++i) {
+    grid[i] = mask[i] === target ? 0 : INF;
+  }
+
+  const size = Math.max(width, height);
+  const f = new Float64Array(size);
+  const d = new Float64Array(size);
+  const v = new Int32Array(size);
+  const z = new Float64Array(size + 1);
+  // 1D transform of the lower envelope of parabolas rooted at each sample:
+  const pass = (n, get, set) => {
+    for (let q = 0; q < n; ++q) f[q] = get(q);
+    let k = 0;
+    v[0] = 0;
+    z[0] = -INF;
+    z[1] = INF;
+    for (let q = 1; q < n; ++q) {
+      let s;
+      do {
+        const r = v[k];
+        s = (f[q] + q * q - (f[r] + r * r)) / (2 * q - 2 * r);
+      } while (s <= z[k] && --k >= 0);
+      ++k;
+      v[k] = q;
+      z[k] = s;
+      z[k + 1] = INF;
+    }
+    k = 0;
+    for (let q = 0; q < n; ++q) {
+      while (z[k + 1] < q) ++k;
+      d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+    for (let q = 0; q < n; ++q) set(q, d[q]);
+  };
+  for (let x = 0; x < width; ++x) {
+    pass(height, y => grid[y * width + x], (y, value) => (grid[y * width + x] = value));
+  }
+  for (let y = 0; y < height; ++y) {
+    pass(width, x => grid[y * width + x], (x, value) => (grid[y * width + x] = value));
+  }
+  return grid;
+}
+
+// minimal RGBA8 png writer (no filtering) for generated images:
+function encodePng(width, height, pixels) {
+  const crcTable = Array.from({ length: 256 }, (_, n) => {
+    let c = n;
+    for (let k = 0; k < 8; ++k) c = c & 1 ? 0xedb88320 ^ (c >>> 1) : c >>> 1;
+    return c >>> 0;
+  });
+  const crc = bytes => {
+    let c = 0xffffffff;
+    for (const byte of bytes) c = crcTable[(c ^ byte) & 0xff] ^ (c >>> 8);
+    return (c ^ 0xffffffff) >>> 0;
+  };
+  const chunk = (type, body) => {
+    const out = Buffer.alloc(12 + body.length);
+    out.writeUInt32BE(body.length, 0);
+    out.write(type, 4, "ascii");
+    body.copy(out, 8);
+    out.writeUInt32BE(crc(out.subarray(4, 8 + body.length)), 8 + body.length);
+    return out;
+  };
+
+  const header = Buffer.alloc(13);
+  header.writeUInt32BE(width, 0);
+  header.writeUInt32BE(height, 4);
+  header[8] = 8; // bit depth
+  header[9] = 6; // RGBA
+  const rows = Buffer.alloc((width * 4 + 1) * height);
+  for (let y = 0; y < height; ++y) {
+    pixels.copy(rows, y * (width * 4 + 1) + 1, y * width * 4, (y + 1) * width * 4);
+  }
+  return Buffer.concat([
+    Buffer.from([0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a]),
+    chunk("IHDR", header),
+    chunk("IDAT", require("zlib").deflateSync(rows)),
+    chunk("IEND", Buffer.alloc(0))
+  ]);
+}
+
 // TODO: allow options, such as verbose mode that prints commands
 
 console.log(
@@ -122,18 +610,28 @@ console.log(
 
 console.log("Press Control + C to exit.\n");
 
+const describe = (directory, filename) => ({
+  filename,
+  directory,
+  extension: filename.slice(filename.lastIndexOf(".")), // including .
+  name: filename.slice(0, filename.lastIndexOf(".")), // without extension
+  fullpath: path.resolve(directory, filename)
+});
+
+files.forEach(fullpath => {
+  const file = describe(path.dirname(fullpath), path.basename(fullpath));
+  if (typeof onChange[file.extension] === "function") {
+    console.log(`Processing ${file.filename}...`);
+    onChange[file.extension](file);
+  }
+});
+
 const watcherCallback = directory => (eventType, filename) => {
   if (!filename) {
     console.error("No filename provided...");
   }
 
-  const file = {
-    filename,
-    directory,
-    extension: filename.slice(filename.lastIndexOf(".")), // including .
-    name: filename.slice(0, filename.lastIndexOf(".")), // without extension
-    fullpath: path.resolve(directory, filename)
-  };
+  const file = describe(directory, filename);
 
   switch (eventType) {
     case "change":
@@ -0,0 +1,9 @@
+// Sprite fragment shader: the atlas texel tinted by the vertex color.
+
+uniform sampler2DArray tex;
+in vec4 color;
+in vec3 texCoord;
+out vec4 fragColor;
+void main() {
+	fragColor = texture(tex, texCoord) * color;
+}
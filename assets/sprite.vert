@@ -0,0 +1,11 @@
+// Sprite vertex shader, shared by every program. Built with "#version 330" and
+// VERTEX_SHADER_INPUTS (vertex.hpp) in front; edits are picked up while the game runs.
+
+layout(std140) uniform Camera { mat4 mvp; };
+out vec3 texCoord;
+out vec4 color;
+void main() {
+	gl_Position = mvp * vertex_position();
+	color = vertex_color();
+	texCoord = vertex_texcoord();
+}
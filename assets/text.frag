@@ -0,0 +1,15 @@
+// Distance field text: ink is the vertex color over a 'background' box (the atlas
+// glyphs' blue); the edge is smoothed over about a pixel, however large the glyph is
+// on screen.
+
+uniform sampler2DArray tex;
+uniform vec4 background;
+in vec4 color;
+in vec3 texCoord;
+out vec4 fragColor;
+void main() {
+	float distance = texture(tex, texCoord).a;
+	float edge = 0.7 * fwidth(distance);
+	float ink = smoothstep(0.5 - edge, 0.5 + edge, distance);
+	fragColor = mix(background, color, ink);
+}
@@ -0,0 +1,62 @@
+#include "atlas.hpp"
+#include "load_save_png.hpp"
+#include "render_state.hpp"
+#include "sprites.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace {
+
+void set_sampling() {
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+}
+
+} // namespace
+
+Atlas::Atlas(glm::uvec2 const &page_size_, uint32_t capacity_) : page_size(page_size_), capacity(capacity_) {
+	glGenTextures(1, &tex);
+	render_state.bind_texture(tex);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, page_size.x, page_size.y, capacity, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+							 nullptr);
+	set_sampling();
+}
+
+bool Atlas::add_page(std::string const &name) {
+	if (pages == capacity) {
+		std::cerr << "Atlas is full, can't add page '" << name << "'" << std::endl;
+		return false;
+	}
+
+	glm::uvec2 size;
+	std::vector< uint32_t > data;
+	if (!load_png(name + ".png", &size.x, &size.y, &data, LowerLeftOrigin)) {
+		std::cerr << "Failed to load atlas page '" << name << ".png'" << std::endl;
+		return false;
+	}
+	if (size != page_size) {
+		std::cerr << "Atlas page '" << name << ".png' is " << size.x << "x" << size.y << ", expected " << page_size.x << "x"
+							<< page_size.y << std::endl;
+		return false;
+	}
+	if (!load_sprite_info(name + ".file", pages)) {
+		return false;
+	}
+
+	render_state.bind_texture(tex);
+	glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, pages, size.x, size.y, 1, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
+	++pages;
+	return true;
+}
+
+GLuint upload_texture_layer(glm::uvec2 const &size, uint32_t const *pixels) {
+	GLuint tex = 0;
+	glGenTextures(1, &tex);
+	render_state.bind_texture(tex);
+	glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, size.x, size.y, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	set_sampling();
+	return tex;
+}
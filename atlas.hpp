@@ -0,0 +1,34 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <stdint.h>
+
+/*
+ * Sprite sheets stored as the layers of one GL_TEXTURE_2D_ARRAY, so sprites from any
+ * page draw in the same batch. Storage for 'capacity' pages is allocated up front and
+ * each page is uploaded into its own layer when it is added, without touching the
+ * others; pages can be added at any point, e.g. when a level that needs them loads.
+ */
+
+struct Atlas {
+	// every page must be 'page_size' pixels (sprite .info coordinates are normalized to it):
+	Atlas(glm::uvec2 const &page_size, uint32_t capacity);
+
+	// loads 'name'.png and 'name'.file, uploads the image to the next layer and appends
+	// its sprites (with that layer) to 'sprites'. Returns false if anything is missing or
+	// the atlas is full:
+	bool add_page(std::string const &name);
+
+	GLuint tex = 0;
+	glm::uvec2 page_size;
+	uint32_t capacity;
+	uint32_t pages = 0;
+};
+
+// the sprite shader samples a texture array; single images (region backgrounds, tilesets)
+// become one-layer arrays. Returns the new texture:
+GLuint upload_texture_layer(glm::uvec2 const &size, uint32_t const *pixels);
@@ -0,0 +1,181 @@
+#include "sprite_batch.hpp"
+#include "quads.hpp"
+#include "vertex.hpp"
+#include "GL.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * Renderer benchmarks. The quad cases build, upload and draw a frame's worth of sprites
+ * 'FRAMES' times and report the time per frame and the bytes uploaded per frame. (The
+ * vertex kernel, which needs no GL, is timed by dist/microbench.)
+ * Run from the repository root: dist/bench
+ */
+
+namespace {
+
+const uint32_t SPRITES = 10000;
+const uint32_t FRAMES = 200;
+
+GLuint compile_shader(GLenum type, std::string const& source) {
+	GLuint shader = glCreateShader(type);
+	GLchar const* str = source.c_str();
+	GLint length = source.size();
+	glShaderSource(shader, 1, &str, &length);
+	glCompileShader(shader);
+	GLint compile_status = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+	if (compile_status != GL_TRUE) {
+		throw std::runtime_error("Failed to compile benchmark shader.");
+	}
+	return shader;
+}
+
+// the sprite shader's inputs, writing only color so fill cost stays small:
+GLuint make_program() {
+	GLuint program = glCreateProgram();
+	glAttachShader(program, compile_shader(GL_VERTEX_SHADER,
+																				 "#version 330\n"
+																				 VERTEX_SHADER_INPUTS
+																				 "out vec4 color;\n"
+																				 "void main() {\n"
+																				 "	gl_Position = vertex_position() * vec4(0.01, 0.01, 1.0, 1.0) + vec4(vertex_texcoord(), 0.0) * 0.0;\n"
+																				 "	color = vertex_color();\n"
+																				 "}\n"));
+	glAttachShader(program, compile_shader(GL_FRAGMENT_SHADER,
+																				 "#version 330\n"
+																				 "in vec4 color;\n"
+																				 "out vec4 fragColor;\n"
+																				 "void main() {\n"
+																				 "	fragColor = color;\n"
+																				 "}\n"));
+	glBindAttribLocation(program, 0, "Position");
+	glBindAttribLocation(program, 1, "TexCoord");
+	glBindAttribLocation(program, 2, "Color");
+	glLinkProgram(program);
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		throw std::runtime_error("Failed to link benchmark program.");
+	}
+	return program;
+}
+
+// tiny sprites scattered over the view:
+glm::vec2 sprite_at(uint32_t i) {
+	return glm::vec2(float(i % 200) - 100.0f, float(i / 200 % 200) - 100.0f);
+}
+
+void report(std::string const& name, double seconds, size_t bytes) {
+	std::cout << name << ": " << (seconds / FRAMES * 1e6) << " us/frame, " << (seconds / FRAMES / SPRITES * 1e9)
+						<< " ns/sprite, " << bytes << " bytes uploaded/frame" << std::endl;
+}
+
+// the six-vertex, degenerate-stitched GL_TRIANGLE_STRIP layout quads used before indexing:
+void bench_strip_quads(VertexAttributes const& attributes, SpriteData const& sprite) {
+	GLuint buffer = 0, vao = 0;
+	glGenBuffers(1, &buffer);
+	glGenVertexArrays(1, &vao);
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	bind_vertex_attributes(attributes);
+
+	std::vector<Vertex> verts;
+	glm::u8vec4 tint(0xff, 0xff, 0xff, 0xff);
+	glm::vec2 rad(0.5f, 0.5f);
+	auto start = std::chrono::high_resolution_clock::now();
+	for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+		verts.clear();
+		for (uint32_t i = 0; i < SPRITES; ++i) {
+			glm::vec2 at = sprite_at(i);
+			verts.emplace_back(at - rad, glm::vec3(sprite.min_uv, 0.0f), tint);
+			verts.emplace_back(verts.back());
+			verts.emplace_back(at + glm::vec2(-rad.x, rad.y), glm::vec3(sprite.min_uv.x, sprite.max_uv.y, 0.0f), tint);
+			verts.emplace_back(at + glm::vec2(rad.x, -rad.y), glm::vec3(sprite.max_uv.x, sprite.min_uv.y, 0.0f), tint);
+			verts.emplace_back(at + rad, glm::vec3(sprite.max_uv, 0.0f), tint);
+			verts.emplace_back(verts.back());
+		}
+		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts.size(), &verts[0], GL_STREAM_DRAW);
+		glDrawArrays(GL_TRIANGLE_STRIP, 0, verts.size());
+		glFinish();
+	}
+	report("strip quads", std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count(),
+				 sizeof(Vertex) * verts.size());
+
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &buffer);
+}
+
+void bench_indexed_quads(VertexAttributes const& attributes, SpriteData const& sprite) {
+	SpriteBatch batch(attributes, GL_STREAM_DRAW);
+	auto start = std::chrono::high_resolution_clock::now();
+	for (uint32_t frame = 0; frame < FRAMES; ++frame) {
+		batch.clear();
+		for (uint32_t i = 0; i < SPRITES; ++i) {
+			batch.draw_sprite(sprite, glm::vec2(0.5f, 0.5f), sprite_at(i));
+		}
+		batch.upload();
+		batch.draw();
+		glFinish();
+	}
+	report("indexed quads", std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count(),
+				 sizeof(Vertex) * batch.verts.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	SDL_Init(SDL_INIT_VIDEO);
+
+	SDL_GL_ResetAttributes();
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+	SDL_Window* window = SDL_CreateWindow("bench", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 640, 480,
+																				SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+	if (!window) {
+		std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+	SDL_GLContext context = SDL_GL_CreateContext(window);
+	if (!context) {
+		SDL_DestroyWindow(window);
+		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+#ifdef _WIN32
+	if (!init_gl_shims()) {
+		std::cerr << "ERROR: failed to initialize shims." << std::endl;
+		return 1;
+	}
+#endif
+
+	SDL_GL_SetSwapInterval(0);
+
+	GLuint program = make_program();
+	glUseProgram(program);
+	VertexAttributes attributes;
+	attributes.Position = 0;
+	attributes.TexCoord = 1;
+	attributes.Color = 2;
+
+	SpriteData sprite;
+	sprite.max_uv = glm::vec2(0.1f);
+
+	bench_strip_quads(attributes, sprite);
+	bench_indexed_quads(attributes, sprite);
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+	return 0;
+}
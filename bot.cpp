@@ -0,0 +1,138 @@
+#include "bot.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// a row no collision box crosses, in any region, so regions are changed along it:
+const float CORRIDOR_Y = -6.0f;
+// inside the workbench volume, clear of its box:
+const glm::vec2 WORKBENCH_AT = glm::vec2(6.5f, -10.5f);
+// under the tree's box, inside its volume:
+const glm::vec2 TREE_AT = glm::vec2(10.25f, 2.5f);
+// the crystal's nook is only reachable once the bridge's box is gone, and is narrower than the player:
+const glm::vec2 CRYSTAL_AT = glm::vec2(-5.5f, 2.25f);
+// ticks without moving, with a direction held, before giving up:
+const uint32_t STUCK_TICKS = 30;
+
+glm::vec2 item_at(Level const& level, std::string const& name) {
+	ItemDef const* def = level.find_item(name);
+	if (!def)
+		throw std::runtime_error("no item named " + name + " in level");
+	return def->at;
+}
+
+glm::vec2 volume_at(Level const& level, std::string const& name) {
+	VolumeDef const* def = level.find_volume(name);
+	if (!def)
+		throw std::runtime_error("no volume named " + name + " in level");
+	return def->center;
+}
+
+std::function< bool(Game const&) > holding(std::string const& name) {
+	return [name](Game const& game) { return game.playerItem && game.playerItem->name == name; };
+}
+
+bool empty_handed(Game const& game) {
+	return !game.playerItem;
+}
+
+std::function< bool(Game const&) > placed(std::string const& name) {
+	return [name](Game const& game) { return game.placed(name); };
+}
+
+} // namespace
+
+Bot::Bot(Game const& game_, float tick_seconds) : game(game_), step(game_.PLAYER_SPEED * tick_seconds), last_at(game_.player.at) {
+	Level const& level = game.level;
+	uint32_t left = region_named(level, "map_left");
+	uint32_t middle = region_named(level, "map_middle");
+	uint32_t right = region_named(level, "map_right");
+
+	// each tool from its two parts:
+	goals.push_back(Goal{"knife", middle, item_at(level, "KNIFE"), holding("KNIFE")});
+	goals.push_back(Goal{"knife", middle, WORKBENCH_AT, empty_handed});
+	goals.push_back(Goal{"rod", right, item_at(level, "ROD"), holding("ROD")});
+	goals.push_back(Goal{"rod", middle, WORKBENCH_AT, [](Game const& game) { return game.hasKnife; }});
+	goals.push_back(Goal{"pickaxe head", right, item_at(level, "PICKAXE_HEAD"), holding("PICKAXE_HEAD")});
+	goals.push_back(Goal{"pickaxe head", middle, WORKBENCH_AT, empty_handed});
+	goals.push_back(Goal{"stick", left, item_at(level, "STICK"), holding("STICK")});
+	goals.push_back(Goal{"stick", middle, WORKBENCH_AT, [](Game const& game) { return game.hasPickaxe; }});
+	goals.push_back(Goal{"boards", left, item_at(level, "BOARDS"), holding("BOARDS")});
+	goals.push_back(Goal{"boards", middle, WORKBENCH_AT, empty_handed});
+	goals.push_back(Goal{"rope", left, item_at(level, "ROPE"), holding("ROPE")});
+	goals.push_back(Goal{"rope", middle, WORKBENCH_AT, [](Game const& game) { return game.hasBridge; }});
+
+	// then the pillars, each with what the tools get to:
+	goals.push_back(Goal{"apple", left, TREE_AT, holding("APPLE")});
+	goals.push_back(Goal{"apple", middle, volume_at(level, "pillar_top"), placed("APPLE")});
+	goals.push_back(Goal{"crystal", left, CRYSTAL_AT, holding("CRYSTAL")});
+	goals.push_back(Goal{"crystal", middle, volume_at(level, "pillar_left"), placed("CRYSTAL")});
+	goals.push_back(Goal{"rock", right, volume_at(level, "scale"), holding("ROCK")});
+	goals.push_back(Goal{"rock", middle, volume_at(level, "pillar_bottom"), placed("ROCK")});
+	goals.push_back(Goal{"coin", right, volume_at(level, "hole"), [](Game const& game) { return game.holeDug; }});
+	goals.push_back(Goal{"coin", right, volume_at(level, "hole"), holding("COIN")});
+	goals.push_back(Goal{"coin", middle, volume_at(level, "pillar_right"), placed("COIN")});
+}
+
+std::string const& Bot::phase() const {
+	static const std::string done = "done";
+	return finished() ? done : goals[goal].phase;
+}
+
+uint8_t Bot::buttons() {
+	if (finished()) {
+		return 0;
+	}
+	Goal const& g = goals[goal];
+
+	// C was down last tick; let it go, and see that it worked:
+	if (interacted) {
+		if (!g.done(game)) {
+			std::ostringstream message;
+			message << "bot's interaction at " << game.player.at.x << ", " << game.player.at.y << " failed in phase '"
+							<< g.phase << "'";
+			throw std::runtime_error(message.str());
+		}
+		interacted = false;
+		++goal;
+		return 0;
+	}
+
+	glm::vec2 at = game.player.at;
+	uint8_t held = 0;
+	if (game.currentMap != g.region) {
+		if (std::abs(CORRIDOR_Y - at.y) >= step.y) {
+			held = CORRIDOR_Y > at.y ? BUTTON_UP : BUTTON_DOWN;
+		} else {
+			int32_t r = game.level.regions[game.currentMap].right;
+			while (r != -1 && uint32_t(r) != g.region) {
+				r = game.level.regions[r].right;
+			}
+			held = r == -1 ? BUTTON_LEFT : BUTTON_RIGHT;
+		}
+	} else {
+		// arrived within a step, as the next one would overshoot:
+		glm::vec2 to = g.at;
+		if (std::abs(to.x - at.x) >= step.x) {
+			held = to.x > at.x ? BUTTON_RIGHT : BUTTON_LEFT;
+		} else if (std::abs(to.y - at.y) >= step.y) {
+			held = to.y > at.y ? BUTTON_UP : BUTTON_DOWN;
+		}
+		if (!held) {
+			interacted = true;
+			return BUTTON_INTERACT;
+		}
+	}
+
+	still = at == last_at ? still + 1 : 0;
+	last_at = at;
+	if (still > STUCK_TICKS) {
+		std::ostringstream message;
+		message << "bot stuck at " << at.x << ", " << at.y << " in phase '" << g.phase << "'";
+		throw std::runtime_error(message.str());
+	}
+	return held;
+}
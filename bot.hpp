@@ -0,0 +1,49 @@
+#pragma once
+
+#include "game.hpp"
+
+#include <glm/glm.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Plays the courtyard from the start to the win through Game::update, choosing the
+ * buttons of each tick from the game's state as a player at the keyboard would: it
+ * crafts the long knife, pickaxe and bridge at the workbench, then places the apple,
+ * crystal, rock and coin on their pillars. Goals are walked to one axis at a time
+ * (regions are changed along a clear row), then interacted with, and each interaction
+ * is checked, so a change to the rules or the level shows up as an error rather than
+ * as a bot walking into a wall forever.
+ */
+
+struct Bot {
+	// 'game' must be fresh from its constructor and advanced 'tick_seconds' per update:
+	Bot(Game const& game, float tick_seconds);
+
+	// the buttons to hold for the next tick; throws if a goal can't be reached or an interaction fails:
+	uint8_t buttons();
+
+	bool finished() const { return goal == goals.size(); }
+	// what the bot is doing, e.g. "knife" while it fetches the knife and takes it to the workbench:
+	std::string const& phase() const;
+
+	struct Goal {
+		std::string phase;
+		uint32_t region;
+		glm::vec2 at; // walked to x first, then y, and interacted with
+		std::function< bool(Game const&) > done; // checked after interacting
+	};
+	std::vector< Goal > goals;
+
+private:
+	Game const& game;
+	glm::vec2 step; // distance walked per tick, so arrival is within one step
+	uint32_t goal = 0;
+	bool interacted = false;
+
+	// to notice being walled in:
+	glm::vec2 last_at;
+	uint32_t still = 0;
+};
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+// Configuration, shared by the game and the tools that run it (see golden.cpp):
+struct Config {
+	std::string title = "Escape The Courtyard";
+	glm::uvec2 size = glm::uvec2(640, 480);
+	std::string level = "assets/courtyard.lvl";
+	size_t region_budget = 256 * 1024;	// bytes of streamed region data kept resident
+	std::vector<std::string> atlas_pages = {"assets/stuff", "assets/glyphs"};	// loaded in order, as listed in SpriteInfo
+	uint32_t atlas_capacity = 4;
+	std::string hint_font = "assets/hint"; // distance field font, see assets/hint.font
+	glm::uvec2 native_size = glm::uvec2(320, 240); // world drawn at the art's resolution, then scaled up; (0, 0) to follow the window
+	float gpu_budget_ms = 8.0f; // without native_size, world resolution drops to keep its GPU time under this; 0 to never scale
+	float min_render_scale = 0.5f; // of the window size
+	std::string shader_cache = "shader-cache"; // linked program binaries; "" to compile every launch
+};
@@ -0,0 +1,144 @@
+#include "draw_list.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace {
+
+const uint64_t SEQUENCE_MASK = (1u << 24) - 1;
+const uint64_t MATERIAL_MASK = 0xffff;
+
+// LSD radix sort on 8-bit digits; passes where every key has the same digit are skipped,
+// which for typical lists (depth unused, few layers and textures) leaves three or four:
+void radix_sort(std::vector<uint64_t>* keys, std::vector<uint64_t>* swap) {
+	swap->resize(keys->size());
+	for (uint32_t shift = 0; shift < 64; shift += 8) {
+		uint32_t counts[256] = {0};
+		for (uint64_t key : *keys) {
+			++counts[(key >> shift) & 0xff];
+		}
+		if (counts[((*keys)[0] >> shift) & 0xff] == keys->size()) {
+			continue;
+		}
+		uint32_t offsets[256];
+		uint32_t total = 0;
+		for (uint32_t d = 0; d < 256; ++d) {
+			offsets[d] = total;
+			total += counts[d];
+		}
+		for (uint64_t key : *keys) {
+			(*swap)[offsets[(key >> shift) & 0xff]++] = key;
+		}
+		keys->swap(*swap);
+	}
+}
+
+} // namespace
+
+void DrawList::submit(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at, uint8_t layer,
+											GLuint texture, glm::u8vec4 tint, float angle, uint16_t depth) {
+	// rotated quads get the bounds of their circumscribed circle:
+	glm::vec2 extent = glm::abs(rad);
+	if (angle != 0.0f) {
+		extent = glm::vec2(glm::length(rad));
+	}
+	min_x.emplace_back(at.x - extent.x);
+	min_y.emplace_back(at.y - extent.y);
+	max_x.emplace_back(at.x + extent.x);
+	max_y.emplace_back(at.y + extent.y);
+
+	uint64_t material = std::find(textures.begin(), textures.end(), texture) - textures.begin();
+	if (material == textures.size()) {
+		textures.emplace_back(texture);
+	}
+	// the key's fields would wrap, and emit() would draw the wrong quads:
+	assert(material <= MATERIAL_MASK && "more textures in a draw list than its sort key holds");
+	assert(quads.size() <= SEQUENCE_MASK && "more quads in a draw list than its sort key holds");
+	keys.emplace_back(uint64_t(layer) << 56 | material << 40 | uint64_t(depth) << 24 | quads.size());
+
+	quads.push_back(sprite, rad, at, tint, angle);
+}
+
+void DrawList::submit_word(std::string const& word, glm::vec2 const& at, uint8_t layer, GLuint texture) {
+	for (unsigned i = 0; i < word.length(); i++) {
+		submit(glyph_sprite(word[i]), glm::vec2(0.5f, 0.6f), glm::vec2(at.x + float(i), at.y), layer, texture);
+	}
+}
+
+void DrawList::clear() {
+	min_x.clear();
+	min_y.clear();
+	max_x.clear();
+	max_y.clear();
+	keys.clear();
+	quads.clear();
+	textures.clear();
+	runs.clear();
+}
+
+DrawList::Stats DrawList::emit(glm::vec2 const& view_min, glm::vec2 const& view_max, SpriteBatch* batch) {
+	size_t count = quads.size();
+	visible.resize(count);
+
+	// branch-free so the compiler can vectorize it over the bounds arrays:
+	float const* x0 = min_x.data();
+	float const* y0 = min_y.data();
+	float const* x1 = max_x.data();
+	float const* y1 = max_y.data();
+	uint8_t* out = visible.data();
+	for (size_t i = 0; i < count; ++i) {
+		out[i] = (x1[i] > x0[i]) & (y1[i] > y0[i]) & (x1[i] >= view_min.x) & (x0[i] <= view_max.x) & (y1[i] >= view_min.y)
+				& (y0[i] <= view_max.y);
+	}
+
+	sorted.clear();
+	for (size_t i = 0; i < count; ++i) {
+		if (visible[i]) {
+			sorted.emplace_back(keys[i]);
+		}
+	}
+
+	Stats stats;
+	stats.drawn = sorted.size();
+	stats.culled = count - stats.drawn;
+	runs.clear();
+	if (sorted.empty()) {
+		return stats;
+	}
+	radix_sort(&sorted, &swap);
+
+	// gather quads in key order, starting a new run when the texture changes or at a barrier:
+	sorted_quads.clear();
+	sorted_quads.reserve(sorted.size());
+	GLint first = batch->verts.size();
+	for (uint64_t key : sorted) {
+		uint8_t layer = uint8_t(key >> 56);
+		GLuint texture = textures[(key >> 40) & MATERIAL_MASK];
+		if (runs.empty() || runs.back().texture != texture || (layer != runs.back().last_layer && barriers[layer])) {
+			Run run;
+			run.first_layer = layer;
+			run.texture = texture;
+			run.first = first + 4 * sorted_quads.size();
+			run.count = 0;
+			runs.emplace_back(run);
+		}
+		runs.back().last_layer = layer;
+		sorted_quads.push_back(quads, key & SEQUENCE_MASK);
+		runs.back().count += 4;
+	}
+
+	// then write all their vertices in one pass:
+	batch->verts.resize(first + 4 * sorted_quads.size());
+	write_quads(sorted_quads, &batch->verts[first]);
+	stats.draw_calls = runs.size();
+	return stats;
+}
+
+void DrawList::draw(SpriteBatch const& batch, uint8_t min_layer, uint8_t max_layer, RenderBackend* backend) const {
+	for (Run const& run : runs) {
+		if (run.first_layer >= min_layer && run.last_layer <= max_layer) {
+			backend->draw(batch, run.first, run.count, run.texture);
+		}
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "sprite_batch.hpp"
+#include "render_backend.hpp"
+#include "quad_kernel.hpp"
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <bitset>
+#include <string>
+#include <vector>
+
+/*
+ * Sprites submitted for a frame (or a static bake), kept as structure-of-arrays bounds
+ * plus a parallel array of quad parameters. emit() tests all bounds against a view
+ * rectangle in one pass over the bounds arrays and only generates vertices for the
+ * sprites that survive, dropping zero-area sprites (items hidden by radius.x = 0) too.
+ *
+ * Each sprite also gets a 64-bit sort key:
+ *   bits 56-63 layer, 40-55 texture (index into 'textures'), 24-39 depth, 0-23 sequence
+ * Survivors are radix sorted by key before vertices are written, so sprites can be
+ * submitted in any order and still come out grouped into one draw call per run of
+ * consecutive keys sharing a texture. Depth defaults to 0, leaving submission order.
+ * Runs never span a layer marked in 'barriers', so other geometry (tile layers) can be
+ * drawn between the layers below and above it. The key limits a list to 2^24 quads and
+ * 65536 textures between clear()s; submit() asserts both.
+ */
+
+struct DrawList {
+	struct Stats {
+		uint32_t drawn = 0;
+		uint32_t culled = 0;
+		uint32_t draw_calls = 0;
+	};
+
+	// consecutive vertices of a SpriteBatch sharing a texture:
+	struct Run {
+		uint8_t first_layer;
+		uint8_t last_layer;
+		GLuint texture;
+		GLint first;
+		GLsizei count;
+	};
+
+	void submit(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at, uint8_t layer, GLuint texture,
+							glm::u8vec4 tint = glm::u8vec4(0xff, 0xff, 0xff, 0xff), float angle = 0.0f, uint16_t depth = 0);
+	void submit_word(std::string const& word, glm::vec2 const& at, uint8_t layer, GLuint texture);
+
+	void clear();
+	size_t size() const { return quads.size(); }
+
+	// appends the sprites overlapping [view_min, view_max] to 'batch' in key order and records their runs:
+	Stats emit(glm::vec2 const& view_min, glm::vec2 const& view_max, SpriteBatch* batch);
+
+	// draws the runs within layers [min_layer, max_layer] from 'batch' (as uploaded after emit(), for GL):
+	void draw(SpriteBatch const& batch, uint8_t min_layer = 0, uint8_t max_layer = 0xff,
+						RenderBackend* backend = &gl_backend) const;
+
+	std::bitset<256> barriers; // layers that always start a new run
+	std::vector<Run> runs;
+
+private:
+	// world-space bounds, one entry per quad:
+	std::vector<float> min_x, min_y, max_x, max_y;
+	std::vector<uint64_t> keys;
+	QuadArrays quads;
+	std::vector<GLuint> textures;
+
+	// scratch space for emit():
+	std::vector<uint8_t> visible;
+	std::vector<uint64_t> sorted, swap;
+	QuadArrays sorted_quads; // visible quads in key order, for write_quads()
+};
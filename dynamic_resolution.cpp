@@ -0,0 +1,58 @@
+#include "dynamic_resolution.hpp"
+#include "gpu_timer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// scales are multiples of STEP, so timing noise doesn't reallocate the target every frame:
+const float STEP = 1.0f / 16.0f;
+// decisions use the average of this many frames:
+const uint32_t WINDOW = 8;
+// only scale up if the predicted cost at the next step leaves this much of the budget spare:
+const float HEADROOM = 0.85f;
+
+} // namespace
+
+DynamicResolution::DynamicResolution(float budget_ms_, float min_scale_) : budget_ms(budget_ms_), min_scale(min_scale_) {
+}
+
+bool DynamicResolution::update(float gpu_ms) {
+	if (settle) {
+		--settle;
+		return false;
+	}
+	total_ms += gpu_ms;
+	if (++samples < WINDOW) {
+		return false;
+	}
+	average_ms = total_ms / samples;
+	total_ms = 0.0f;
+	samples = 0;
+
+	// cost is taken to be proportional to pixels, i.e. to scale squared:
+	float wanted = scale;
+	if (average_ms > budget_ms) {
+		wanted = std::floor(scale * std::sqrt(budget_ms / average_ms) / STEP) * STEP;
+		wanted = std::min(wanted, scale - STEP);
+	} else {
+		float up = (scale + STEP) / scale;
+		if (average_ms * up * up < budget_ms * HEADROOM) {
+			wanted = scale + STEP;
+		}
+	}
+	wanted = std::max(min_scale, std::min(1.0f, wanted));
+
+	if (wanted == scale) {
+		return false;
+	}
+	scale = wanted;
+	// timings already in flight were drawn at the old size:
+	settle = GpuTimer::RING;
+	return true;
+}
+
+glm::uvec2 DynamicResolution::target_size(glm::uvec2 const& window) const {
+	return glm::max(glm::uvec2(glm::round(glm::vec2(window) * scale)), glm::uvec2(1));
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <stdint.h>
+
+/*
+ * Chooses the scale of the scene's render target so its GPU time stays within a budget.
+ * Timings are averaged over a few frames. Over budget, the scale drops straight to what
+ * the average predicts will fit (cost is taken to grow with pixel count); it only rises,
+ * one step at a time, while the next step is predicted to fit with room to spare. Timings
+ * arrive late (see GpuTimer), so after a change those of frames drawn at the old size are
+ * ignored.
+ */
+
+struct DynamicResolution {
+	DynamicResolution(float budget_ms, float min_scale);
+
+	// feed the scene's GPU time for a frame; returns true if 'scale' changed:
+	bool update(float gpu_ms);
+
+	// 'window' times 'scale', at least one pixel each way:
+	glm::uvec2 target_size(glm::uvec2 const& window) const;
+
+	float budget_ms;
+	float min_scale;
+	float scale = 1.0f;
+	float average_ms = 0.0f; // the average behind the latest decision
+
+private:
+	uint32_t settle = 0; // measurements to ignore after a change
+	float total_ms = 0.0f; // of the measurements averaged so far
+	uint32_t samples = 0;
+};
@@ -0,0 +1,362 @@
+#include "game.hpp"
+
+#include <stdexcept>
+
+namespace {
+
+VolumeDef const& volume(Level const& level, std::string const& name) {
+	VolumeDef const* def = level.find_volume(name);
+	if (!def)
+		throw std::runtime_error("no volume named " + name + " in level");
+	return *def;
+}
+
+PropDef const& prop(Level const& level, std::string const& name) {
+	PropDef const* def = level.find_prop(name);
+	if (!def)
+		throw std::runtime_error("no prop named " + name + " in level");
+	return *def;
+}
+
+// 64-bit FNV-1a, over the bytes of plain values (floats by their bits):
+struct Hasher {
+	uint64_t h = 0xcbf29ce484222325ULL;
+
+	void bytes(void const* data, size_t size) {
+		for (size_t i = 0; i < size; ++i) {
+			h = (h ^ static_cast< uint8_t const* >(data)[i]) * 0x100000001b3ULL;
+		}
+	}
+	template< typename T >
+	void add(T const& value) {
+		bytes(&value, sizeof(T));
+	}
+	void add(std::string const& value) {
+		add(uint32_t(value.size()));
+		bytes(value.data(), value.size());
+	}
+};
+
+} // namespace
+
+Game::Game(Level const& level_, RegionStreamer* streamer_)
+		: level(level_), streamer(*streamer_), currentMap(level_.start_region),
+			tree(volume(level_, "tree")), treeCircle(tree.center, tree.radius), workbenchDef(volume(level_, "workbench")),
+			workbench(workbenchDef.center, workbenchDef.radius), items(level_.regions.size()), doorDef(prop(level_, "door")),
+			door(make_object(doorDef)), scaleDef(prop(level_, "scale")), scaleVolume(volume(level_, "scale")),
+			scale(make_object(scaleDef), Circle(scaleVolume.center, scaleVolume.radius), Workbench::EMPTY),
+			bridgeDef(prop(level_, "bridge")), bridgeObject(make_object(bridgeDef)), holeDef(volume(level_, "hole")),
+			hole(holeDef.center, holeDef.radius), holeObject(make_object(prop(level_, "hole"))) {
+	streamer.require(currentMap);
+
+	for (const BoxDef& def : level.boxes) {
+		if (std::string(level.string(def.name)) == "bridge") {
+			bridgeName = def.name;
+		}
+	}
+
+	player.at = level.start_at;
+	player.radius = glm::vec2(0.5f, 1.0f);
+	player.sprite = load_sprite(PLAYER);
+	player.bounds.set(player.at, player.radius);
+
+	for (uint32_t r = 0; r < level.regions.size(); ++r) {
+		items[r].reserve(level.regions[r].items.count);
+	}
+	for (const ItemDef& def : level.items) {
+		if (!(def.flags & ITEM_SPAWNED)) {
+			items[def.region].emplace_back(make_item(def));
+		}
+	}
+
+	for (const VolumeDef& def : level.volumes) {
+		if (def.accepts) {
+			ItemDef const* accepted = level.find_item(level.string(def.accepts));
+			if (!accepted)
+				throw std::runtime_error("pillar accepts unknown item " + std::string(level.string(def.accepts)));
+			pillars.emplace_back(def.region, Circle(def.center, def.radius), level.string(def.accepts),
+													 Object(def.center, def.display, load_sprite(SpriteInfo(accepted->sprite)), BoundingBox()));
+		}
+	}
+
+	for (const RecipeDef& def : level.recipes) {
+		recipes.emplace_back(Workbench(def.needs), SpriteInfo(def.result), level.string(def.hint));
+	}
+
+	enter_region(currentMap);
+}
+
+Game::Object Game::make_object(PropDef const& def) const {
+	return Object(def.at, def.radius, load_sprite(SpriteInfo(def.sprite)), BoundingBox(def.at, {0.0f, 0.0f}));
+}
+
+Game::Item Game::make_item(ItemDef const& def) const {
+	return Item(Object(def.at, def.radius, load_sprite(SpriteInfo(def.sprite)), BoundingBox({0.0f, 0.0f}, {0.0f, 0.0f})),
+							Circle(def.at, def.reach), Workbench(def.adds), level.string(def.name));
+}
+
+ItemDef const& Game::spawnable(std::string const& name) const {
+	ItemDef const* def = level.find_item(name);
+	if (!def || !(def->flags & ITEM_SPAWNED))
+		throw std::runtime_error("no spawned item named " + name + " in level");
+	return *def;
+}
+
+Game::Item* Game::find_item(uint32_t region, std::string const& name) {
+	for (Item& item : items[region]) {
+		if (item.name == name) {
+			return &item;
+		}
+	}
+	return nullptr;
+}
+
+bool Game::placed(std::string const& name) const {
+	for (const Pillar& pillar : pillars) {
+		if (pillar.filled && pillar.accepts == name) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool Game::won() const {
+	bool win = !pillars.empty();
+	for (const Pillar& pillar : pillars) {
+		win = win && pillar.filled;
+	}
+	return win;
+}
+
+uint64_t Game::hash() const {
+	Hasher hasher;
+	hasher.add(ticks);
+	hasher.add(random);
+	hasher.add(currentMap);
+	hasher.add(player.at);
+	hasher.add(player.radius);
+	hasher.add(playerItem ? playerItem->name : std::string());
+	for (std::vector<Item> const& region : items) {
+		hasher.add(uint32_t(region.size()));
+		for (Item const& item : region) {
+			hasher.add(item.obj.at);
+			hasher.add(item.obj.radius);
+			hasher.add(item.circle.radius);
+		}
+	}
+	for (Pillar const& pillar : pillars) {
+		hasher.add(pillar.filled);
+	}
+	for (Recipe const& recipe : recipes) {
+		hasher.add(recipe.built);
+	}
+	hasher.add(workbenchState);
+	hasher.add(scale.obj.sprite.min_uv); // balanced or not
+	hasher.add(holeDug);
+	hasher.add(hasPickaxe);
+	hasher.add(hasBridge);
+	hasher.add(hasKnife);
+	hasher.add(hint);
+	hasher.add(hintTimer);
+	hasher.add(prevButtons);
+	return hasher.h;
+}
+
+void Game::fit_camera(glm::uvec2 const& view_size) {
+	camera.radius.x = camera.radius.y * (float(view_size.x) / float(view_size.y));
+}
+
+void Game::enter_region(uint32_t region) {
+	currentMap = region;
+	++revision;
+	map.radius = level.regions[region].radius;
+	if (level.regions[region].sprite != -1U) {
+		map.sprite = load_sprite(SpriteInfo(level.regions[region].sprite));
+	}
+}
+
+void Game::update(uint8_t buttons, float elapsed) {
+	++ticks;
+	++random;
+
+	hintTimer += elapsed;
+
+	glm::vec2 delta = glm::vec2(0.0f);
+
+	if (buttons & BUTTON_LEFT) {
+		delta.x -= PLAYER_SPEED.x * elapsed;
+		if (player.radius.x < 0.0f) {
+			player.radius.x = -player.radius.x;
+		}
+	}
+
+	if (buttons & BUTTON_RIGHT) {
+		delta.x += PLAYER_SPEED.x * elapsed;
+		if (player.radius.x > 0.0f) {
+			player.radius.x = -player.radius.x;
+		}
+	}
+
+	if (buttons & BUTTON_UP) {
+		delta.y += PLAYER_SPEED.y * elapsed;
+	}
+
+	if (buttons & BUTTON_DOWN) {
+		delta.y -= PLAYER_SPEED.y * elapsed;
+	}
+
+	if ((buttons & BUTTON_INTERACT) && !(prevButtons & BUTTON_INTERACT)) {
+		interact();
+	}
+	prevButtons = buttons;
+
+	player.bounds.set(player.at + delta, player.radius);
+
+	RegionStreamer::Resident const& here = streamer.require(currentMap);
+	for (uint32_t i = 0; i < here.boxes.size(); ++i) {
+		if (hasBridge && bridgeName && here.box_names[i] == bridgeName) {
+			continue;
+		}
+		if (here.boxes[i].contains(player.bounds)) {
+			delta.x = delta.y = 0.0f;
+		}
+	}
+
+	RegionDef const& region = level.regions[currentMap];
+	if (player.bounds.min.y < -region.radius.y) {
+		delta.y = 0.0f;
+	}
+
+	// start loading a neighbour before the player gets there:
+	const float PREFETCH_MARGIN = 4.0f;
+	if (region.right != -1 && player.bounds.max.x > region.radius.x - 0.25f - PREFETCH_MARGIN) {
+		streamer.prefetch(region.right);
+	}
+	if (region.left != -1 && player.bounds.min.x < -region.radius.x + 0.25f + PREFETCH_MARGIN) {
+		streamer.prefetch(region.left);
+	}
+
+	if (player.bounds.max.x > region.radius.x - 0.25f) {
+		if (region.right != -1) {
+			enter_region(region.right);
+			player.at.x = -level.regions[currentMap].radius.x + 0.25f + player.radius.x;
+		}
+	} else if (player.bounds.min.x < -region.radius.x + 0.25f) {
+		if (region.left != -1) {
+			enter_region(region.left);
+			player.at.x = level.regions[currentMap].radius.x - 0.25f - player.radius.x;
+		}
+	}
+
+	player.at += delta;
+	player.bounds.set(player.at, player.radius);
+
+	// follow the player, keeping the view inside the region:
+	glm::vec2 slack = glm::max(level.regions[currentMap].radius - camera.radius, glm::vec2(0.0f));
+	camera.at = glm::clamp(player.at, -slack, slack);
+}
+
+void Game::interact() {
+	bool done = false;
+	// any interaction may move items, fill pillars or build tools:
+	++revision;
+
+	if (playerItem) {
+		if (currentMap == workbenchDef.region && workbench.contains(player.at)) {
+			workbenchState = workbenchState | playerItem->addition;
+			for (Recipe& recipe : recipes) {
+				if (!recipe.built && (workbenchState & recipe.needs) == recipe.needs) {
+					recipe.built = true;
+					hint = recipe.hint;
+					hintTimer = 0.0f;
+					if (recipe.result == BRIDGE) {
+						hasBridge = true;
+					} else if (recipe.result == LONG_KNIFE) {
+						hasKnife = true;
+					} else if (recipe.result == PICKAXE) {
+						hasPickaxe = true;
+					}
+					break;
+				}
+			}
+
+			// hide old object and radius
+			playerItem->obj.radius.x = 0.0f;
+			playerItem->circle.radius = 0.0f;
+			playerItem = nullptr;
+			done = true;
+		}
+
+		// get or set item on pillars
+		for (Pillar& pillar : pillars) {
+			if (playerItem && pillar.region == currentMap && playerItem->name == pillar.accepts
+					&& pillar.circle.contains(player.at)) {
+				// hide old object and radius
+				playerItem->obj.radius.x = 0.0f;
+				playerItem->circle.radius = 0.0f;
+				playerItem = nullptr;
+
+				pillar.filled = true;
+
+				done = true;
+			}
+		}
+	} else {
+		// dig hole
+		if (!done && currentMap == holeDef.region && !holeDug && hole.contains(player.at)) {
+			if (hasPickaxe) {
+				items[holeDef.region].emplace_back(make_item(spawnable("COIN")));
+				holeDug = true;
+				hint = "YOU FOUND SOMETHING";
+				hintTimer = 5.0f;
+				done = true;
+			} else {
+				hint = "YOU NEED A TOOL";
+				done = true;
+				hintTimer = 0.0f;
+			}
+		}
+
+		// cut apple
+		if (!done && !placed("APPLE") && currentMap == tree.region && hasKnife && treeCircle.contains(player.at)) {
+			playerItem = find_item(tree.region, "APPLE");
+			hint = "NICE FIND";
+			hintTimer = 0.0f;
+			done = true;
+		}
+
+		// grab from scale
+		if (!done && !placed("ROCK") && currentMap == scaleVolume.region && scale.circle.contains(player.at)) {
+			scale.obj.sprite = load_sprite(SCALE_UNBALANCED);
+			items[scaleVolume.region].emplace_back(make_item(spawnable("ROCK")));
+			playerItem = &items[scaleVolume.region].back();
+			done = true;
+		}
+
+		// grab items
+		for (auto item = items[currentMap].begin(); !done && item != items[currentMap].end(); ++item) {
+			if (item->circle.contains(player.at)) {
+				playerItem = &(*item);
+				hintTimer = 20.0f;	// remove any hint
+				done = true;
+			}
+		}
+	}
+
+	RegionStreamer::Resident const& here = streamer.require(currentMap);
+	for (size_t h = 0; !done && h < here.hints.size(); ++h) {
+		if (here.hints[h].contains(player.at)) {
+			hint = level.string(here.hint_texts[h]);
+			done = true;
+			hintTimer = 0.0f;
+		}
+	}
+	if (!done) {
+		if (random % 5 == 0) {
+			hint = "MAKE SOME TOOLS";
+		} else {
+			hint = "FIND SOMETHING MEANINGFUL";
+		}
+		hintTimer = 8.0f;	// start timer late because this hint sucks
+	}
+}
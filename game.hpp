@@ -0,0 +1,181 @@
+#pragma once
+
+#include "level.hpp"
+#include "geometry.hpp"
+#include "region_streamer.hpp"
+#include "sprites.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+// from https://stackoverflow.com/a/33971769
+// I think enum bitmaps are cool so even though this is verbose/overkill I put it in
+enum class Workbench : uint32_t {
+	EMPTY = 0,
+	HAS_BOARDS = (1 << 0),
+	HAS_ROPE = (1 << 1),
+	HAS_PICK_HEAD = (1 << 2),
+	HAS_STICK = (1 << 3),
+	HAS_KNIFE = (1 << 4),
+	HAS_ROD = (1 << 5)
+};
+inline enum Workbench operator|(const enum Workbench self, const enum Workbench other) {
+	return (enum Workbench)(uint32_t(self) | uint32_t(other));
+}
+inline enum Workbench operator&(const enum Workbench self, const enum Workbench other) {
+	return (enum Workbench)(uint32_t(self) & uint32_t(other));
+}
+
+// buttons held during a tick; main reads them from the keyboard (A, D, W, S, C), tools script them:
+enum Button : uint8_t {
+	BUTTON_LEFT = (1 << 0),
+	BUTTON_RIGHT = (1 << 1),
+	BUTTON_UP = (1 << 2),
+	BUTTON_DOWN = (1 << 3),
+	BUTTON_INTERACT = (1 << 4),
+};
+
+/*
+ * The state of one playthrough and the rules that advance it, without any drawing, so
+ * the same game can be played from the keyboard, scripted, or rendered by Renderer.
+ * Collision boxes and hint volumes come from the RegionStreamer, which only needs a GL
+ * context when it streams images.
+ */
+
+struct Game {
+	// throws if the level lacks a volume or prop the rules refer to:
+	Game(Level const& level, RegionStreamer* streamer);
+	// items are referred to by pointer:
+	Game(Game const&) = delete;
+	Game& operator=(Game const&) = delete;
+
+	// advance 'elapsed' seconds with 'buttons' held; C interacts on the tick it goes down:
+	void update(uint8_t buttons, float elapsed);
+
+	// correct the camera radius for the aspect ratio of the view:
+	void fit_camera(glm::uvec2 const& view_size);
+
+	void enter_region(uint32_t region);
+	// the item is on its pillar:
+	bool placed(std::string const& name) const;
+	bool won() const;
+
+	// 64-bit FNV-1a of everything update() reads or writes, to check replays tick by tick.
+	// Leaves out the camera, which follows the window size (fit_camera) and is not in the input log:
+	uint64_t hash() const;
+
+	struct Object {
+		glm::vec2 at = glm::vec2(0.0f);
+		glm::vec2 radius = glm::vec2(1.0f);
+		SpriteData sprite;
+		BoundingBox bounds;
+
+		Object(){};
+		Object(glm::vec2 at, glm::vec2 radius, SpriteData sprite, BoundingBox bounds)
+				: at(at), radius(radius), sprite(sprite), bounds(bounds){};
+	};
+
+	struct Item {
+		Object obj;
+		Circle circle;
+		Workbench addition;
+		std::string name;
+
+		Item(){};
+		Item(Object obj, Circle circle, Workbench addition, std::string name="") : obj(obj), circle(circle), addition(addition), name(name){};
+	};
+
+	// items are placed on pillars by name:
+	struct Pillar {
+		uint32_t region;
+		Circle circle;
+		std::string accepts;
+		Object display;
+		bool filled;
+
+		Pillar(uint32_t region, Circle circle, std::string accepts, Object display)
+				: region(region), circle(circle), accepts(accepts), display(display), filled(false){};
+	};
+
+	struct Recipe {
+		Workbench needs;
+		SpriteInfo result;
+		std::string hint;
+		bool built;
+
+		Recipe(Workbench needs, SpriteInfo result, std::string hint) : needs(needs), result(result), hint(hint), built(false){};
+	};
+
+	Level const& level;
+	RegionStreamer& streamer;
+
+	// bumped whenever something drawn from the static batches (region, items, props, tools) changes:
+	uint32_t revision = 0;
+	uint32_t ticks = 0;
+	// picks between the fallback hints:
+	unsigned random = 0;
+
+	struct {
+		glm::vec2 at = glm::vec2(0.0f, 0.0f);
+		glm::vec2 radius = glm::vec2(16.0f, 12.0f);
+	} camera;
+
+	uint32_t currentMap;
+
+	VolumeDef const& tree;
+	Circle treeCircle;
+
+	VolumeDef const& workbenchDef;
+	Circle workbench;
+	Workbench workbenchState = Workbench::EMPTY;
+
+	// the bridge's collision box is skipped once the bridge is built:
+	uint32_t bridgeName = 0;
+
+	Object player;
+	const glm::vec2 PLAYER_SPEED = glm::vec2(10.0f, 8.5f);
+
+	Item* playerItem = nullptr;
+	// each region reserves room for its spawned items too, so playerItem pointers stay valid:
+	std::vector<std::vector<Item>> items;
+	std::vector<Pillar> pillars;
+	std::vector<Recipe> recipes;
+
+	PropDef const& doorDef;
+	Object door;
+
+	PropDef const& scaleDef;
+	VolumeDef const& scaleVolume;
+	Item scale;
+
+	PropDef const& bridgeDef;
+	Object bridgeObject;
+
+	// for digging
+	VolumeDef const& holeDef;
+	Circle hole;
+	Object holeObject;
+	bool holeDug = false;
+
+	// background of the current region (its atlas sprite is used when it has no streamed image):
+	Object map;
+
+	bool hasPickaxe = false;
+	bool hasBridge = false;
+	bool hasKnife = false;
+
+	std::string hint = "PRESS C TO INTERACT";
+	float hintTimer = -10.0f;	// start off giving extra time
+
+private:
+	void interact();
+	Object make_object(PropDef const& def) const;
+	Item make_item(ItemDef const& def) const;
+	ItemDef const& spawnable(std::string const& name) const;
+	Item* find_item(uint32_t region, std::string const& name);
+
+	uint8_t prevButtons = 0;
+};
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+// Collision and interaction shapes shared by gameplay and the level streamer.
+
+struct BoundingBox {
+	glm::vec2 min;
+	glm::vec2 max;
+	glm::vec2 center;
+	glm::vec2 radius;
+
+	BoundingBox(){};
+	BoundingBox(glm::vec2 center, glm::vec2 radius) { set(center, radius); };
+
+	void set(const glm::vec2& cent, const glm::vec2& rad) {
+		center = cent;
+		radius = rad;
+		min.x = center.x - rad.x;
+		min.y = center.y - rad.y;
+		max.x = center.x + rad.x;
+		max.y = center.y + rad.y;
+	}
+
+	// AABB from
+	// https://developer.mozilla.org/en-US/docs/Games/Techniques/2D_collision_detection#Axis-Aligned_Bounding_Box
+	bool contains(const BoundingBox& other) const {
+		return (min.x < other.max.x && max.x > other.min.x && min.y < other.max.y && max.y > other.min.y);
+	}
+};
+
+struct Circle {
+	glm::vec2 center;
+	float radius;
+
+	Circle(){};
+	Circle(glm::vec2 center, float radius) : center(center), radius(radius){};
+
+	bool contains(const glm::vec2& point) const {
+		float dx = center.x - point.x;
+		float dy = center.y - point.y;
+		float distance = std::sqrt(dx * dx + dy * dy);
+
+		return distance < radius;
+	}
+};
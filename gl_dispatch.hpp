@@ -0,0 +1,1057 @@
+//generated by make-gl-shims.py; see gl_stats.hpp
+
+//Included through GL.hpp, this redirects every gl* call to a counting wrapper.
+//gl_stats.cpp includes it with GL_DISPATCH defined to get one entry per wrapper instead:
+//  GL_DISPATCH(return type, name without 'gl', (parameters), (arguments))
+
+#ifndef GL_DISPATCH
+
+#ifndef GL_DISPATCH_HPP
+#define GL_DISPATCH_HPP 1
+
+extern "C" {
+
+GLAPI void APIENTRY gl_stats_CullFace (GLenum mode);
+#define glCullFace gl_stats_CullFace
+GLAPI void APIENTRY gl_stats_FrontFace (GLenum mode);
+#define glFrontFace gl_stats_FrontFace
+GLAPI void APIENTRY gl_stats_Hint (GLenum target, GLenum mode);
+#define glHint gl_stats_Hint
+GLAPI void APIENTRY gl_stats_LineWidth (GLfloat width);
+#define glLineWidth gl_stats_LineWidth
+GLAPI void APIENTRY gl_stats_PointSize (GLfloat size);
+#define glPointSize gl_stats_PointSize
+GLAPI void APIENTRY gl_stats_PolygonMode (GLenum face, GLenum mode);
+#define glPolygonMode gl_stats_PolygonMode
+GLAPI void APIENTRY gl_stats_Scissor (GLint x, GLint y, GLsizei width, GLsizei height);
+#define glScissor gl_stats_Scissor
+GLAPI void APIENTRY gl_stats_TexParameterf (GLenum target, GLenum pname, GLfloat param);
+#define glTexParameterf gl_stats_TexParameterf
+GLAPI void APIENTRY gl_stats_TexParameterfv (GLenum target, GLenum pname, const GLfloat *params);
+#define glTexParameterfv gl_stats_TexParameterfv
+GLAPI void APIENTRY gl_stats_TexParameteri (GLenum target, GLenum pname, GLint param);
+#define glTexParameteri gl_stats_TexParameteri
+GLAPI void APIENTRY gl_stats_TexParameteriv (GLenum target, GLenum pname, const GLint *params);
+#define glTexParameteriv gl_stats_TexParameteriv
+GLAPI void APIENTRY gl_stats_TexImage1D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels);
+#define glTexImage1D gl_stats_TexImage1D
+GLAPI void APIENTRY gl_stats_TexImage2D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels);
+#define glTexImage2D gl_stats_TexImage2D
+GLAPI void APIENTRY gl_stats_DrawBuffer (GLenum buf);
+#define glDrawBuffer gl_stats_DrawBuffer
+GLAPI void APIENTRY gl_stats_Clear (GLbitfield mask);
+#define glClear gl_stats_Clear
+GLAPI void APIENTRY gl_stats_ClearColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+#define glClearColor gl_stats_ClearColor
+GLAPI void APIENTRY gl_stats_ClearStencil (GLint s);
+#define glClearStencil gl_stats_ClearStencil
+GLAPI void APIENTRY gl_stats_ClearDepth (GLdouble depth);
+#define glClearDepth gl_stats_ClearDepth
+GLAPI void APIENTRY gl_stats_StencilMask (GLuint mask);
+#define glStencilMask gl_stats_StencilMask
+GLAPI void APIENTRY gl_stats_ColorMask (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+#define glColorMask gl_stats_ColorMask
+GLAPI void APIENTRY gl_stats_DepthMask (GLboolean flag);
+#define glDepthMask gl_stats_DepthMask
+GLAPI void APIENTRY gl_stats_Disable (GLenum cap);
+#define glDisable gl_stats_Disable
+GLAPI void APIENTRY gl_stats_Enable (GLenum cap);
+#define glEnable gl_stats_Enable
+GLAPI void APIENTRY gl_stats_Finish (void);
+#define glFinish gl_stats_Finish
+GLAPI void APIENTRY gl_stats_Flush (void);
+#define glFlush gl_stats_Flush
+GLAPI void APIENTRY gl_stats_BlendFunc (GLenum sfactor, GLenum dfactor);
+#define glBlendFunc gl_stats_BlendFunc
+GLAPI void APIENTRY gl_stats_LogicOp (GLenum opcode);
+#define glLogicOp gl_stats_LogicOp
+GLAPI void APIENTRY gl_stats_StencilFunc (GLenum func, GLint ref, GLuint mask);
+#define glStencilFunc gl_stats_StencilFunc
+GLAPI void APIENTRY gl_stats_StencilOp (GLenum fail, GLenum zfail, GLenum zpass);
+#define glStencilOp gl_stats_StencilOp
+GLAPI void APIENTRY gl_stats_DepthFunc (GLenum func);
+#define glDepthFunc gl_stats_DepthFunc
+GLAPI void APIENTRY gl_stats_PixelStoref (GLenum pname, GLfloat param);
+#define glPixelStoref gl_stats_PixelStoref
+GLAPI void APIENTRY gl_stats_PixelStorei (GLenum pname, GLint param);
+#define glPixelStorei gl_stats_PixelStorei
+GLAPI void APIENTRY gl_stats_ReadBuffer (GLenum src);
+#define glReadBuffer gl_stats_ReadBuffer
+GLAPI void APIENTRY gl_stats_ReadPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels);
+#define glReadPixels gl_stats_ReadPixels
+GLAPI void APIENTRY gl_stats_GetBooleanv (GLenum pname, GLboolean *data);
+#define glGetBooleanv gl_stats_GetBooleanv
+GLAPI void APIENTRY gl_stats_GetDoublev (GLenum pname, GLdouble *data);
+#define glGetDoublev gl_stats_GetDoublev
+GLAPI GLenum APIENTRY gl_stats_GetError (void);
+#define glGetError gl_stats_GetError
+GLAPI void APIENTRY gl_stats_GetFloatv (GLenum pname, GLfloat *data);
+#define glGetFloatv gl_stats_GetFloatv
+GLAPI void APIENTRY gl_stats_GetIntegerv (GLenum pname, GLint *data);
+#define glGetIntegerv gl_stats_GetIntegerv
+GLAPI const GLubyte * APIENTRY gl_stats_GetString (GLenum name);
+#define glGetString gl_stats_GetString
+GLAPI void APIENTRY gl_stats_GetTexImage (GLenum target, GLint level, GLenum format, GLenum type, void *pixels);
+#define glGetTexImage gl_stats_GetTexImage
+GLAPI void APIENTRY gl_stats_GetTexParameterfv (GLenum target, GLenum pname, GLfloat *params);
+#define glGetTexParameterfv gl_stats_GetTexParameterfv
+GLAPI void APIENTRY gl_stats_GetTexParameteriv (GLenum target, GLenum pname, GLint *params);
+#define glGetTexParameteriv gl_stats_GetTexParameteriv
+GLAPI void APIENTRY gl_stats_GetTexLevelParameterfv (GLenum target, GLint level, GLenum pname, GLfloat *params);
+#define glGetTexLevelParameterfv gl_stats_GetTexLevelParameterfv
+GLAPI void APIENTRY gl_stats_GetTexLevelParameteriv (GLenum target, GLint level, GLenum pname, GLint *params);
+#define glGetTexLevelParameteriv gl_stats_GetTexLevelParameteriv
+GLAPI GLboolean APIENTRY gl_stats_IsEnabled (GLenum cap);
+#define glIsEnabled gl_stats_IsEnabled
+GLAPI void APIENTRY gl_stats_DepthRange (GLdouble near, GLdouble far);
+#define glDepthRange gl_stats_DepthRange
+GLAPI void APIENTRY gl_stats_Viewport (GLint x, GLint y, GLsizei width, GLsizei height);
+#define glViewport gl_stats_Viewport
+GLAPI void APIENTRY gl_stats_DrawArrays (GLenum mode, GLint first, GLsizei count);
+#define glDrawArrays gl_stats_DrawArrays
+GLAPI void APIENTRY gl_stats_DrawElements (GLenum mode, GLsizei count, GLenum type, const void *indices);
+#define glDrawElements gl_stats_DrawElements
+GLAPI void APIENTRY gl_stats_GetPointerv (GLenum pname, void **params);
+#define glGetPointerv gl_stats_GetPointerv
+GLAPI void APIENTRY gl_stats_PolygonOffset (GLfloat factor, GLfloat units);
+#define glPolygonOffset gl_stats_PolygonOffset
+GLAPI void APIENTRY gl_stats_CopyTexImage1D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border);
+#define glCopyTexImage1D gl_stats_CopyTexImage1D
+GLAPI void APIENTRY gl_stats_CopyTexImage2D (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border);
+#define glCopyTexImage2D gl_stats_CopyTexImage2D
+GLAPI void APIENTRY gl_stats_CopyTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width);
+#define glCopyTexSubImage1D gl_stats_CopyTexSubImage1D
+GLAPI void APIENTRY gl_stats_CopyTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+#define glCopyTexSubImage2D gl_stats_CopyTexSubImage2D
+GLAPI void APIENTRY gl_stats_TexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels);
+#define glTexSubImage1D gl_stats_TexSubImage1D
+GLAPI void APIENTRY gl_stats_TexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels);
+#define glTexSubImage2D gl_stats_TexSubImage2D
+GLAPI void APIENTRY gl_stats_BindTexture (GLenum target, GLuint texture);
+#define glBindTexture gl_stats_BindTexture
+GLAPI void APIENTRY gl_stats_DeleteTextures (GLsizei n, const GLuint *textures);
+#define glDeleteTextures gl_stats_DeleteTextures
+GLAPI void APIENTRY gl_stats_GenTextures (GLsizei n, GLuint *textures);
+#define glGenTextures gl_stats_GenTextures
+GLAPI GLboolean APIENTRY gl_stats_IsTexture (GLuint texture);
+#define glIsTexture gl_stats_IsTexture
+GLAPI void APIENTRY gl_stats_DrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices);
+#define glDrawRangeElements gl_stats_DrawRangeElements
+GLAPI void APIENTRY gl_stats_TexImage3D (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels);
+#define glTexImage3D gl_stats_TexImage3D
+GLAPI void APIENTRY gl_stats_TexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels);
+#define glTexSubImage3D gl_stats_TexSubImage3D
+GLAPI void APIENTRY gl_stats_CopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+#define glCopyTexSubImage3D gl_stats_CopyTexSubImage3D
+GLAPI void APIENTRY gl_stats_ActiveTexture (GLenum texture);
+#define glActiveTexture gl_stats_ActiveTexture
+GLAPI void APIENTRY gl_stats_SampleCoverage (GLfloat value, GLboolean invert);
+#define glSampleCoverage gl_stats_SampleCoverage
+GLAPI void APIENTRY gl_stats_CompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data);
+#define glCompressedTexImage3D gl_stats_CompressedTexImage3D
+GLAPI void APIENTRY gl_stats_CompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data);
+#define glCompressedTexImage2D gl_stats_CompressedTexImage2D
+GLAPI void APIENTRY gl_stats_CompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data);
+#define glCompressedTexImage1D gl_stats_CompressedTexImage1D
+GLAPI void APIENTRY gl_stats_CompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTexSubImage3D gl_stats_CompressedTexSubImage3D
+GLAPI void APIENTRY gl_stats_CompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTexSubImage2D gl_stats_CompressedTexSubImage2D
+GLAPI void APIENTRY gl_stats_CompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data);
+#define glCompressedTexSubImage1D gl_stats_CompressedTexSubImage1D
+GLAPI void APIENTRY gl_stats_GetCompressedTexImage (GLenum target, GLint level, void *img);
+#define glGetCompressedTexImage gl_stats_GetCompressedTexImage
+GLAPI void APIENTRY gl_stats_BlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+#define glBlendFuncSeparate gl_stats_BlendFuncSeparate
+GLAPI void APIENTRY gl_stats_MultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount);
+#define glMultiDrawArrays gl_stats_MultiDrawArrays
+GLAPI void APIENTRY gl_stats_MultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount);
+#define glMultiDrawElements gl_stats_MultiDrawElements
+GLAPI void APIENTRY gl_stats_PointParameterf (GLenum pname, GLfloat param);
+#define glPointParameterf gl_stats_PointParameterf
+GLAPI void APIENTRY gl_stats_PointParameterfv (GLenum pname, const GLfloat *params);
+#define glPointParameterfv gl_stats_PointParameterfv
+GLAPI void APIENTRY gl_stats_PointParameteri (GLenum pname, GLint param);
+#define glPointParameteri gl_stats_PointParameteri
+GLAPI void APIENTRY gl_stats_PointParameteriv (GLenum pname, const GLint *params);
+#define glPointParameteriv gl_stats_PointParameteriv
+GLAPI void APIENTRY gl_stats_BlendColor (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+#define glBlendColor gl_stats_BlendColor
+GLAPI void APIENTRY gl_stats_BlendEquation (GLenum mode);
+#define glBlendEquation gl_stats_BlendEquation
+GLAPI void APIENTRY gl_stats_GenQueries (GLsizei n, GLuint *ids);
+#define glGenQueries gl_stats_GenQueries
+GLAPI void APIENTRY gl_stats_DeleteQueries (GLsizei n, const GLuint *ids);
+#define glDeleteQueries gl_stats_DeleteQueries
+GLAPI GLboolean APIENTRY gl_stats_IsQuery (GLuint id);
+#define glIsQuery gl_stats_IsQuery
+GLAPI void APIENTRY gl_stats_BeginQuery (GLenum target, GLuint id);
+#define glBeginQuery gl_stats_BeginQuery
+GLAPI void APIENTRY gl_stats_EndQuery (GLenum target);
+#define glEndQuery gl_stats_EndQuery
+GLAPI void APIENTRY gl_stats_GetQueryiv (GLenum target, GLenum pname, GLint *params);
+#define glGetQueryiv gl_stats_GetQueryiv
+GLAPI void APIENTRY gl_stats_GetQueryObjectiv (GLuint id, GLenum pname, GLint *params);
+#define glGetQueryObjectiv gl_stats_GetQueryObjectiv
+GLAPI void APIENTRY gl_stats_GetQueryObjectuiv (GLuint id, GLenum pname, GLuint *params);
+#define glGetQueryObjectuiv gl_stats_GetQueryObjectuiv
+GLAPI void APIENTRY gl_stats_BindBuffer (GLenum target, GLuint buffer);
+#define glBindBuffer gl_stats_BindBuffer
+GLAPI void APIENTRY gl_stats_DeleteBuffers (GLsizei n, const GLuint *buffers);
+#define glDeleteBuffers gl_stats_DeleteBuffers
+GLAPI void APIENTRY gl_stats_GenBuffers (GLsizei n, GLuint *buffers);
+#define glGenBuffers gl_stats_GenBuffers
+GLAPI GLboolean APIENTRY gl_stats_IsBuffer (GLuint buffer);
+#define glIsBuffer gl_stats_IsBuffer
+GLAPI void APIENTRY gl_stats_BufferData (GLenum target, GLsizeiptr size, const void *data, GLenum usage);
+#define glBufferData gl_stats_BufferData
+GLAPI void APIENTRY gl_stats_BufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void *data);
+#define glBufferSubData gl_stats_BufferSubData
+GLAPI void APIENTRY gl_stats_GetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void *data);
+#define glGetBufferSubData gl_stats_GetBufferSubData
+GLAPI void * APIENTRY gl_stats_MapBuffer (GLenum target, GLenum access);
+#define glMapBuffer gl_stats_MapBuffer
+GLAPI GLboolean APIENTRY gl_stats_UnmapBuffer (GLenum target);
+#define glUnmapBuffer gl_stats_UnmapBuffer
+GLAPI void APIENTRY gl_stats_GetBufferParameteriv (GLenum target, GLenum pname, GLint *params);
+#define glGetBufferParameteriv gl_stats_GetBufferParameteriv
+GLAPI void APIENTRY gl_stats_GetBufferPointerv (GLenum target, GLenum pname, void **params);
+#define glGetBufferPointerv gl_stats_GetBufferPointerv
+GLAPI void APIENTRY gl_stats_BlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha);
+#define glBlendEquationSeparate gl_stats_BlendEquationSeparate
+GLAPI void APIENTRY gl_stats_DrawBuffers (GLsizei n, const GLenum *bufs);
+#define glDrawBuffers gl_stats_DrawBuffers
+GLAPI void APIENTRY gl_stats_StencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass);
+#define glStencilOpSeparate gl_stats_StencilOpSeparate
+GLAPI void APIENTRY gl_stats_StencilFuncSeparate (GLenum face, GLenum func, GLint ref, GLuint mask);
+#define glStencilFuncSeparate gl_stats_StencilFuncSeparate
+GLAPI void APIENTRY gl_stats_StencilMaskSeparate (GLenum face, GLuint mask);
+#define glStencilMaskSeparate gl_stats_StencilMaskSeparate
+GLAPI void APIENTRY gl_stats_AttachShader (GLuint program, GLuint shader);
+#define glAttachShader gl_stats_AttachShader
+GLAPI void APIENTRY gl_stats_BindAttribLocation (GLuint program, GLuint index, const GLchar *name);
+#define glBindAttribLocation gl_stats_BindAttribLocation
+GLAPI void APIENTRY gl_stats_CompileShader (GLuint shader);
+#define glCompileShader gl_stats_CompileShader
+GLAPI GLuint APIENTRY gl_stats_CreateProgram (void);
+#define glCreateProgram gl_stats_CreateProgram
+GLAPI GLuint APIENTRY gl_stats_CreateShader (GLenum type);
+#define glCreateShader gl_stats_CreateShader
+GLAPI void APIENTRY gl_stats_DeleteProgram (GLuint program);
+#define glDeleteProgram gl_stats_DeleteProgram
+GLAPI void APIENTRY gl_stats_DeleteShader (GLuint shader);
+#define glDeleteShader gl_stats_DeleteShader
+GLAPI void APIENTRY gl_stats_DetachShader (GLuint program, GLuint shader);
+#define glDetachShader gl_stats_DetachShader
+GLAPI void APIENTRY gl_stats_DisableVertexAttribArray (GLuint index);
+#define glDisableVertexAttribArray gl_stats_DisableVertexAttribArray
+GLAPI void APIENTRY gl_stats_EnableVertexAttribArray (GLuint index);
+#define glEnableVertexAttribArray gl_stats_EnableVertexAttribArray
+GLAPI void APIENTRY gl_stats_GetActiveAttrib (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+#define glGetActiveAttrib gl_stats_GetActiveAttrib
+GLAPI void APIENTRY gl_stats_GetActiveUniform (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name);
+#define glGetActiveUniform gl_stats_GetActiveUniform
+GLAPI void APIENTRY gl_stats_GetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders);
+#define glGetAttachedShaders gl_stats_GetAttachedShaders
+GLAPI GLint APIENTRY gl_stats_GetAttribLocation (GLuint program, const GLchar *name);
+#define glGetAttribLocation gl_stats_GetAttribLocation
+GLAPI void APIENTRY gl_stats_GetProgramiv (GLuint program, GLenum pname, GLint *params);
+#define glGetProgramiv gl_stats_GetProgramiv
+GLAPI void APIENTRY gl_stats_GetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+#define glGetProgramInfoLog gl_stats_GetProgramInfoLog
+GLAPI void APIENTRY gl_stats_GetShaderiv (GLuint shader, GLenum pname, GLint *params);
+#define glGetShaderiv gl_stats_GetShaderiv
+GLAPI void APIENTRY gl_stats_GetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+#define glGetShaderInfoLog gl_stats_GetShaderInfoLog
+GLAPI void APIENTRY gl_stats_GetShaderSource (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source);
+#define glGetShaderSource gl_stats_GetShaderSource
+GLAPI GLint APIENTRY gl_stats_GetUniformLocation (GLuint program, const GLchar *name);
+#define glGetUniformLocation gl_stats_GetUniformLocation
+GLAPI void APIENTRY gl_stats_GetUniformfv (GLuint program, GLint location, GLfloat *params);
+#define glGetUniformfv gl_stats_GetUniformfv
+GLAPI void APIENTRY gl_stats_GetUniformiv (GLuint program, GLint location, GLint *params);
+#define glGetUniformiv gl_stats_GetUniformiv
+GLAPI void APIENTRY gl_stats_GetVertexAttribdv (GLuint index, GLenum pname, GLdouble *params);
+#define glGetVertexAttribdv gl_stats_GetVertexAttribdv
+GLAPI void APIENTRY gl_stats_GetVertexAttribfv (GLuint index, GLenum pname, GLfloat *params);
+#define glGetVertexAttribfv gl_stats_GetVertexAttribfv
+GLAPI void APIENTRY gl_stats_GetVertexAttribiv (GLuint index, GLenum pname, GLint *params);
+#define glGetVertexAttribiv gl_stats_GetVertexAttribiv
+GLAPI void APIENTRY gl_stats_GetVertexAttribPointerv (GLuint index, GLenum pname, void **pointer);
+#define glGetVertexAttribPointerv gl_stats_GetVertexAttribPointerv
+GLAPI GLboolean APIENTRY gl_stats_IsProgram (GLuint program);
+#define glIsProgram gl_stats_IsProgram
+GLAPI GLboolean APIENTRY gl_stats_IsShader (GLuint shader);
+#define glIsShader gl_stats_IsShader
+GLAPI void APIENTRY gl_stats_LinkProgram (GLuint program);
+#define glLinkProgram gl_stats_LinkProgram
+GLAPI void APIENTRY gl_stats_ShaderSource (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length);
+#define glShaderSource gl_stats_ShaderSource
+GLAPI void APIENTRY gl_stats_UseProgram (GLuint program);
+#define glUseProgram gl_stats_UseProgram
+GLAPI void APIENTRY gl_stats_Uniform1f (GLint location, GLfloat v0);
+#define glUniform1f gl_stats_Uniform1f
+GLAPI void APIENTRY gl_stats_Uniform2f (GLint location, GLfloat v0, GLfloat v1);
+#define glUniform2f gl_stats_Uniform2f
+GLAPI void APIENTRY gl_stats_Uniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+#define glUniform3f gl_stats_Uniform3f
+GLAPI void APIENTRY gl_stats_Uniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+#define glUniform4f gl_stats_Uniform4f
+GLAPI void APIENTRY gl_stats_Uniform1i (GLint location, GLint v0);
+#define glUniform1i gl_stats_Uniform1i
+GLAPI void APIENTRY gl_stats_Uniform2i (GLint location, GLint v0, GLint v1);
+#define glUniform2i gl_stats_Uniform2i
+GLAPI void APIENTRY gl_stats_Uniform3i (GLint location, GLint v0, GLint v1, GLint v2);
+#define glUniform3i gl_stats_Uniform3i
+GLAPI void APIENTRY gl_stats_Uniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3);
+#define glUniform4i gl_stats_Uniform4i
+GLAPI void APIENTRY gl_stats_Uniform1fv (GLint location, GLsizei count, const GLfloat *value);
+#define glUniform1fv gl_stats_Uniform1fv
+GLAPI void APIENTRY gl_stats_Uniform2fv (GLint location, GLsizei count, const GLfloat *value);
+#define glUniform2fv gl_stats_Uniform2fv
+GLAPI void APIENTRY gl_stats_Uniform3fv (GLint location, GLsizei count, const GLfloat *value);
+#define glUniform3fv gl_stats_Uniform3fv
+GLAPI void APIENTRY gl_stats_Uniform4fv (GLint location, GLsizei count, const GLfloat *value);
+#define glUniform4fv gl_stats_Uniform4fv
+GLAPI void APIENTRY gl_stats_Uniform1iv (GLint location, GLsizei count, const GLint *value);
+#define glUniform1iv gl_stats_Uniform1iv
+GLAPI void APIENTRY gl_stats_Uniform2iv (GLint location, GLsizei count, const GLint *value);
+#define glUniform2iv gl_stats_Uniform2iv
+GLAPI void APIENTRY gl_stats_Uniform3iv (GLint location, GLsizei count, const GLint *value);
+#define glUniform3iv gl_stats_Uniform3iv
+GLAPI void APIENTRY gl_stats_Uniform4iv (GLint location, GLsizei count, const GLint *value);
+#define glUniform4iv gl_stats_Uniform4iv
+GLAPI void APIENTRY gl_stats_UniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix2fv gl_stats_UniformMatrix2fv
+GLAPI void APIENTRY gl_stats_UniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix3fv gl_stats_UniformMatrix3fv
+GLAPI void APIENTRY gl_stats_UniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix4fv gl_stats_UniformMatrix4fv
+GLAPI void APIENTRY gl_stats_ValidateProgram (GLuint program);
+#define glValidateProgram gl_stats_ValidateProgram
+GLAPI void APIENTRY gl_stats_VertexAttrib1d (GLuint index, GLdouble x);
+#define glVertexAttrib1d gl_stats_VertexAttrib1d
+GLAPI void APIENTRY gl_stats_VertexAttrib1dv (GLuint index, const GLdouble *v);
+#define glVertexAttrib1dv gl_stats_VertexAttrib1dv
+GLAPI void APIENTRY gl_stats_VertexAttrib1f (GLuint index, GLfloat x);
+#define glVertexAttrib1f gl_stats_VertexAttrib1f
+GLAPI void APIENTRY gl_stats_VertexAttrib1fv (GLuint index, const GLfloat *v);
+#define glVertexAttrib1fv gl_stats_VertexAttrib1fv
+GLAPI void APIENTRY gl_stats_VertexAttrib1s (GLuint index, GLshort x);
+#define glVertexAttrib1s gl_stats_VertexAttrib1s
+GLAPI void APIENTRY gl_stats_VertexAttrib1sv (GLuint index, const GLshort *v);
+#define glVertexAttrib1sv gl_stats_VertexAttrib1sv
+GLAPI void APIENTRY gl_stats_VertexAttrib2d (GLuint index, GLdouble x, GLdouble y);
+#define glVertexAttrib2d gl_stats_VertexAttrib2d
+GLAPI void APIENTRY gl_stats_VertexAttrib2dv (GLuint index, const GLdouble *v);
+#define glVertexAttrib2dv gl_stats_VertexAttrib2dv
+GLAPI void APIENTRY gl_stats_VertexAttrib2f (GLuint index, GLfloat x, GLfloat y);
+#define glVertexAttrib2f gl_stats_VertexAttrib2f
+GLAPI void APIENTRY gl_stats_VertexAttrib2fv (GLuint index, const GLfloat *v);
+#define glVertexAttrib2fv gl_stats_VertexAttrib2fv
+GLAPI void APIENTRY gl_stats_VertexAttrib2s (GLuint index, GLshort x, GLshort y);
+#define glVertexAttrib2s gl_stats_VertexAttrib2s
+GLAPI void APIENTRY gl_stats_VertexAttrib2sv (GLuint index, const GLshort *v);
+#define glVertexAttrib2sv gl_stats_VertexAttrib2sv
+GLAPI void APIENTRY gl_stats_VertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z);
+#define glVertexAttrib3d gl_stats_VertexAttrib3d
+GLAPI void APIENTRY gl_stats_VertexAttrib3dv (GLuint index, const GLdouble *v);
+#define glVertexAttrib3dv gl_stats_VertexAttrib3dv
+GLAPI void APIENTRY gl_stats_VertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z);
+#define glVertexAttrib3f gl_stats_VertexAttrib3f
+GLAPI void APIENTRY gl_stats_VertexAttrib3fv (GLuint index, const GLfloat *v);
+#define glVertexAttrib3fv gl_stats_VertexAttrib3fv
+GLAPI void APIENTRY gl_stats_VertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z);
+#define glVertexAttrib3s gl_stats_VertexAttrib3s
+GLAPI void APIENTRY gl_stats_VertexAttrib3sv (GLuint index, const GLshort *v);
+#define glVertexAttrib3sv gl_stats_VertexAttrib3sv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nbv (GLuint index, const GLbyte *v);
+#define glVertexAttrib4Nbv gl_stats_VertexAttrib4Nbv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Niv (GLuint index, const GLint *v);
+#define glVertexAttrib4Niv gl_stats_VertexAttrib4Niv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nsv (GLuint index, const GLshort *v);
+#define glVertexAttrib4Nsv gl_stats_VertexAttrib4Nsv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w);
+#define glVertexAttrib4Nub gl_stats_VertexAttrib4Nub
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nubv (GLuint index, const GLubyte *v);
+#define glVertexAttrib4Nubv gl_stats_VertexAttrib4Nubv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nuiv (GLuint index, const GLuint *v);
+#define glVertexAttrib4Nuiv gl_stats_VertexAttrib4Nuiv
+GLAPI void APIENTRY gl_stats_VertexAttrib4Nusv (GLuint index, const GLushort *v);
+#define glVertexAttrib4Nusv gl_stats_VertexAttrib4Nusv
+GLAPI void APIENTRY gl_stats_VertexAttrib4bv (GLuint index, const GLbyte *v);
+#define glVertexAttrib4bv gl_stats_VertexAttrib4bv
+GLAPI void APIENTRY gl_stats_VertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w);
+#define glVertexAttrib4d gl_stats_VertexAttrib4d
+GLAPI void APIENTRY gl_stats_VertexAttrib4dv (GLuint index, const GLdouble *v);
+#define glVertexAttrib4dv gl_stats_VertexAttrib4dv
+GLAPI void APIENTRY gl_stats_VertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w);
+#define glVertexAttrib4f gl_stats_VertexAttrib4f
+GLAPI void APIENTRY gl_stats_VertexAttrib4fv (GLuint index, const GLfloat *v);
+#define glVertexAttrib4fv gl_stats_VertexAttrib4fv
+GLAPI void APIENTRY gl_stats_VertexAttrib4iv (GLuint index, const GLint *v);
+#define glVertexAttrib4iv gl_stats_VertexAttrib4iv
+GLAPI void APIENTRY gl_stats_VertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w);
+#define glVertexAttrib4s gl_stats_VertexAttrib4s
+GLAPI void APIENTRY gl_stats_VertexAttrib4sv (GLuint index, const GLshort *v);
+#define glVertexAttrib4sv gl_stats_VertexAttrib4sv
+GLAPI void APIENTRY gl_stats_VertexAttrib4ubv (GLuint index, const GLubyte *v);
+#define glVertexAttrib4ubv gl_stats_VertexAttrib4ubv
+GLAPI void APIENTRY gl_stats_VertexAttrib4uiv (GLuint index, const GLuint *v);
+#define glVertexAttrib4uiv gl_stats_VertexAttrib4uiv
+GLAPI void APIENTRY gl_stats_VertexAttrib4usv (GLuint index, const GLushort *v);
+#define glVertexAttrib4usv gl_stats_VertexAttrib4usv
+GLAPI void APIENTRY gl_stats_VertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer);
+#define glVertexAttribPointer gl_stats_VertexAttribPointer
+GLAPI void APIENTRY gl_stats_UniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix2x3fv gl_stats_UniformMatrix2x3fv
+GLAPI void APIENTRY gl_stats_UniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix3x2fv gl_stats_UniformMatrix3x2fv
+GLAPI void APIENTRY gl_stats_UniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix2x4fv gl_stats_UniformMatrix2x4fv
+GLAPI void APIENTRY gl_stats_UniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix4x2fv gl_stats_UniformMatrix4x2fv
+GLAPI void APIENTRY gl_stats_UniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix3x4fv gl_stats_UniformMatrix3x4fv
+GLAPI void APIENTRY gl_stats_UniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+#define glUniformMatrix4x3fv gl_stats_UniformMatrix4x3fv
+GLAPI void APIENTRY gl_stats_ColorMaski (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a);
+#define glColorMaski gl_stats_ColorMaski
+GLAPI void APIENTRY gl_stats_GetBooleani_v (GLenum target, GLuint index, GLboolean *data);
+#define glGetBooleani_v gl_stats_GetBooleani_v
+GLAPI void APIENTRY gl_stats_GetIntegeri_v (GLenum target, GLuint index, GLint *data);
+#define glGetIntegeri_v gl_stats_GetIntegeri_v
+GLAPI void APIENTRY gl_stats_Enablei (GLenum target, GLuint index);
+#define glEnablei gl_stats_Enablei
+GLAPI void APIENTRY gl_stats_Disablei (GLenum target, GLuint index);
+#define glDisablei gl_stats_Disablei
+GLAPI GLboolean APIENTRY gl_stats_IsEnabledi (GLenum target, GLuint index);
+#define glIsEnabledi gl_stats_IsEnabledi
+GLAPI void APIENTRY gl_stats_BeginTransformFeedback (GLenum primitiveMode);
+#define glBeginTransformFeedback gl_stats_BeginTransformFeedback
+GLAPI void APIENTRY gl_stats_EndTransformFeedback (void);
+#define glEndTransformFeedback gl_stats_EndTransformFeedback
+GLAPI void APIENTRY gl_stats_BindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+#define glBindBufferRange gl_stats_BindBufferRange
+GLAPI void APIENTRY gl_stats_BindBufferBase (GLenum target, GLuint index, GLuint buffer);
+#define glBindBufferBase gl_stats_BindBufferBase
+GLAPI void APIENTRY gl_stats_TransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode);
+#define glTransformFeedbackVaryings gl_stats_TransformFeedbackVaryings
+GLAPI void APIENTRY gl_stats_GetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name);
+#define glGetTransformFeedbackVarying gl_stats_GetTransformFeedbackVarying
+GLAPI void APIENTRY gl_stats_ClampColor (GLenum target, GLenum clamp);
+#define glClampColor gl_stats_ClampColor
+GLAPI void APIENTRY gl_stats_BeginConditionalRender (GLuint id, GLenum mode);
+#define glBeginConditionalRender gl_stats_BeginConditionalRender
+GLAPI void APIENTRY gl_stats_EndConditionalRender (void);
+#define glEndConditionalRender gl_stats_EndConditionalRender
+GLAPI void APIENTRY gl_stats_VertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer);
+#define glVertexAttribIPointer gl_stats_VertexAttribIPointer
+GLAPI void APIENTRY gl_stats_GetVertexAttribIiv (GLuint index, GLenum pname, GLint *params);
+#define glGetVertexAttribIiv gl_stats_GetVertexAttribIiv
+GLAPI void APIENTRY gl_stats_GetVertexAttribIuiv (GLuint index, GLenum pname, GLuint *params);
+#define glGetVertexAttribIuiv gl_stats_GetVertexAttribIuiv
+GLAPI void APIENTRY gl_stats_VertexAttribI1i (GLuint index, GLint x);
+#define glVertexAttribI1i gl_stats_VertexAttribI1i
+GLAPI void APIENTRY gl_stats_VertexAttribI2i (GLuint index, GLint x, GLint y);
+#define glVertexAttribI2i gl_stats_VertexAttribI2i
+GLAPI void APIENTRY gl_stats_VertexAttribI3i (GLuint index, GLint x, GLint y, GLint z);
+#define glVertexAttribI3i gl_stats_VertexAttribI3i
+GLAPI void APIENTRY gl_stats_VertexAttribI4i (GLuint index, GLint x, GLint y, GLint z, GLint w);
+#define glVertexAttribI4i gl_stats_VertexAttribI4i
+GLAPI void APIENTRY gl_stats_VertexAttribI1ui (GLuint index, GLuint x);
+#define glVertexAttribI1ui gl_stats_VertexAttribI1ui
+GLAPI void APIENTRY gl_stats_VertexAttribI2ui (GLuint index, GLuint x, GLuint y);
+#define glVertexAttribI2ui gl_stats_VertexAttribI2ui
+GLAPI void APIENTRY gl_stats_VertexAttribI3ui (GLuint index, GLuint x, GLuint y, GLuint z);
+#define glVertexAttribI3ui gl_stats_VertexAttribI3ui
+GLAPI void APIENTRY gl_stats_VertexAttribI4ui (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w);
+#define glVertexAttribI4ui gl_stats_VertexAttribI4ui
+GLAPI void APIENTRY gl_stats_VertexAttribI1iv (GLuint index, const GLint *v);
+#define glVertexAttribI1iv gl_stats_VertexAttribI1iv
+GLAPI void APIENTRY gl_stats_VertexAttribI2iv (GLuint index, const GLint *v);
+#define glVertexAttribI2iv gl_stats_VertexAttribI2iv
+GLAPI void APIENTRY gl_stats_VertexAttribI3iv (GLuint index, const GLint *v);
+#define glVertexAttribI3iv gl_stats_VertexAttribI3iv
+GLAPI void APIENTRY gl_stats_VertexAttribI4iv (GLuint index, const GLint *v);
+#define glVertexAttribI4iv gl_stats_VertexAttribI4iv
+GLAPI void APIENTRY gl_stats_VertexAttribI1uiv (GLuint index, const GLuint *v);
+#define glVertexAttribI1uiv gl_stats_VertexAttribI1uiv
+GLAPI void APIENTRY gl_stats_VertexAttribI2uiv (GLuint index, const GLuint *v);
+#define glVertexAttribI2uiv gl_stats_VertexAttribI2uiv
+GLAPI void APIENTRY gl_stats_VertexAttribI3uiv (GLuint index, const GLuint *v);
+#define glVertexAttribI3uiv gl_stats_VertexAttribI3uiv
+GLAPI void APIENTRY gl_stats_VertexAttribI4uiv (GLuint index, const GLuint *v);
+#define glVertexAttribI4uiv gl_stats_VertexAttribI4uiv
+GLAPI void APIENTRY gl_stats_VertexAttribI4bv (GLuint index, const GLbyte *v);
+#define glVertexAttribI4bv gl_stats_VertexAttribI4bv
+GLAPI void APIENTRY gl_stats_VertexAttribI4sv (GLuint index, const GLshort *v);
+#define glVertexAttribI4sv gl_stats_VertexAttribI4sv
+GLAPI void APIENTRY gl_stats_VertexAttribI4ubv (GLuint index, const GLubyte *v);
+#define glVertexAttribI4ubv gl_stats_VertexAttribI4ubv
+GLAPI void APIENTRY gl_stats_VertexAttribI4usv (GLuint index, const GLushort *v);
+#define glVertexAttribI4usv gl_stats_VertexAttribI4usv
+GLAPI void APIENTRY gl_stats_GetUniformuiv (GLuint program, GLint location, GLuint *params);
+#define glGetUniformuiv gl_stats_GetUniformuiv
+GLAPI void APIENTRY gl_stats_BindFragDataLocation (GLuint program, GLuint color, const GLchar *name);
+#define glBindFragDataLocation gl_stats_BindFragDataLocation
+GLAPI GLint APIENTRY gl_stats_GetFragDataLocation (GLuint program, const GLchar *name);
+#define glGetFragDataLocation gl_stats_GetFragDataLocation
+GLAPI void APIENTRY gl_stats_Uniform1ui (GLint location, GLuint v0);
+#define glUniform1ui gl_stats_Uniform1ui
+GLAPI void APIENTRY gl_stats_Uniform2ui (GLint location, GLuint v0, GLuint v1);
+#define glUniform2ui gl_stats_Uniform2ui
+GLAPI void APIENTRY gl_stats_Uniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2);
+#define glUniform3ui gl_stats_Uniform3ui
+GLAPI void APIENTRY gl_stats_Uniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3);
+#define glUniform4ui gl_stats_Uniform4ui
+GLAPI void APIENTRY gl_stats_Uniform1uiv (GLint location, GLsizei count, const GLuint *value);
+#define glUniform1uiv gl_stats_Uniform1uiv
+GLAPI void APIENTRY gl_stats_Uniform2uiv (GLint location, GLsizei count, const GLuint *value);
+#define glUniform2uiv gl_stats_Uniform2uiv
+GLAPI void APIENTRY gl_stats_Uniform3uiv (GLint location, GLsizei count, const GLuint *value);
+#define glUniform3uiv gl_stats_Uniform3uiv
+GLAPI void APIENTRY gl_stats_Uniform4uiv (GLint location, GLsizei count, const GLuint *value);
+#define glUniform4uiv gl_stats_Uniform4uiv
+GLAPI void APIENTRY gl_stats_TexParameterIiv (GLenum target, GLenum pname, const GLint *params);
+#define glTexParameterIiv gl_stats_TexParameterIiv
+GLAPI void APIENTRY gl_stats_TexParameterIuiv (GLenum target, GLenum pname, const GLuint *params);
+#define glTexParameterIuiv gl_stats_TexParameterIuiv
+GLAPI void APIENTRY gl_stats_GetTexParameterIiv (GLenum target, GLenum pname, GLint *params);
+#define glGetTexParameterIiv gl_stats_GetTexParameterIiv
+GLAPI void APIENTRY gl_stats_GetTexParameterIuiv (GLenum target, GLenum pname, GLuint *params);
+#define glGetTexParameterIuiv gl_stats_GetTexParameterIuiv
+GLAPI void APIENTRY gl_stats_ClearBufferiv (GLenum buffer, GLint drawbuffer, const GLint *value);
+#define glClearBufferiv gl_stats_ClearBufferiv
+GLAPI void APIENTRY gl_stats_ClearBufferuiv (GLenum buffer, GLint drawbuffer, const GLuint *value);
+#define glClearBufferuiv gl_stats_ClearBufferuiv
+GLAPI void APIENTRY gl_stats_ClearBufferfv (GLenum buffer, GLint drawbuffer, const GLfloat *value);
+#define glClearBufferfv gl_stats_ClearBufferfv
+GLAPI void APIENTRY gl_stats_ClearBufferfi (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil);
+#define glClearBufferfi gl_stats_ClearBufferfi
+GLAPI const GLubyte * APIENTRY gl_stats_GetStringi (GLenum name, GLuint index);
+#define glGetStringi gl_stats_GetStringi
+GLAPI GLboolean APIENTRY gl_stats_IsRenderbuffer (GLuint renderbuffer);
+#define glIsRenderbuffer gl_stats_IsRenderbuffer
+GLAPI void APIENTRY gl_stats_BindRenderbuffer (GLenum target, GLuint renderbuffer);
+#define glBindRenderbuffer gl_stats_BindRenderbuffer
+GLAPI void APIENTRY gl_stats_DeleteRenderbuffers (GLsizei n, const GLuint *renderbuffers);
+#define glDeleteRenderbuffers gl_stats_DeleteRenderbuffers
+GLAPI void APIENTRY gl_stats_GenRenderbuffers (GLsizei n, GLuint *renderbuffers);
+#define glGenRenderbuffers gl_stats_GenRenderbuffers
+GLAPI void APIENTRY gl_stats_RenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+#define glRenderbufferStorage gl_stats_RenderbufferStorage
+GLAPI void APIENTRY gl_stats_GetRenderbufferParameteriv (GLenum target, GLenum pname, GLint *params);
+#define glGetRenderbufferParameteriv gl_stats_GetRenderbufferParameteriv
+GLAPI GLboolean APIENTRY gl_stats_IsFramebuffer (GLuint framebuffer);
+#define glIsFramebuffer gl_stats_IsFramebuffer
+GLAPI void APIENTRY gl_stats_BindFramebuffer (GLenum target, GLuint framebuffer);
+#define glBindFramebuffer gl_stats_BindFramebuffer
+GLAPI void APIENTRY gl_stats_DeleteFramebuffers (GLsizei n, const GLuint *framebuffers);
+#define glDeleteFramebuffers gl_stats_DeleteFramebuffers
+GLAPI void APIENTRY gl_stats_GenFramebuffers (GLsizei n, GLuint *framebuffers);
+#define glGenFramebuffers gl_stats_GenFramebuffers
+GLAPI GLenum APIENTRY gl_stats_CheckFramebufferStatus (GLenum target);
+#define glCheckFramebufferStatus gl_stats_CheckFramebufferStatus
+GLAPI void APIENTRY gl_stats_FramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+#define glFramebufferTexture1D gl_stats_FramebufferTexture1D
+GLAPI void APIENTRY gl_stats_FramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+#define glFramebufferTexture2D gl_stats_FramebufferTexture2D
+GLAPI void APIENTRY gl_stats_FramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset);
+#define glFramebufferTexture3D gl_stats_FramebufferTexture3D
+GLAPI void APIENTRY gl_stats_FramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+#define glFramebufferRenderbuffer gl_stats_FramebufferRenderbuffer
+GLAPI void APIENTRY gl_stats_GetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint *params);
+#define glGetFramebufferAttachmentParameteriv gl_stats_GetFramebufferAttachmentParameteriv
+GLAPI void APIENTRY gl_stats_GenerateMipmap (GLenum target);
+#define glGenerateMipmap gl_stats_GenerateMipmap
+GLAPI void APIENTRY gl_stats_BlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+#define glBlitFramebuffer gl_stats_BlitFramebuffer
+GLAPI void APIENTRY gl_stats_RenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height);
+#define glRenderbufferStorageMultisample gl_stats_RenderbufferStorageMultisample
+GLAPI void APIENTRY gl_stats_FramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer);
+#define glFramebufferTextureLayer gl_stats_FramebufferTextureLayer
+GLAPI void * APIENTRY gl_stats_MapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+#define glMapBufferRange gl_stats_MapBufferRange
+GLAPI void APIENTRY gl_stats_FlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length);
+#define glFlushMappedBufferRange gl_stats_FlushMappedBufferRange
+GLAPI void APIENTRY gl_stats_BindVertexArray (GLuint array);
+#define glBindVertexArray gl_stats_BindVertexArray
+GLAPI void APIENTRY gl_stats_DeleteVertexArrays (GLsizei n, const GLuint *arrays);
+#define glDeleteVertexArrays gl_stats_DeleteVertexArrays
+GLAPI void APIENTRY gl_stats_GenVertexArrays (GLsizei n, GLuint *arrays);
+#define glGenVertexArrays gl_stats_GenVertexArrays
+GLAPI GLboolean APIENTRY gl_stats_IsVertexArray (GLuint array);
+#define glIsVertexArray gl_stats_IsVertexArray
+GLAPI void APIENTRY gl_stats_DrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei instancecount);
+#define glDrawArraysInstanced gl_stats_DrawArraysInstanced
+GLAPI void APIENTRY gl_stats_DrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount);
+#define glDrawElementsInstanced gl_stats_DrawElementsInstanced
+GLAPI void APIENTRY gl_stats_TexBuffer (GLenum target, GLenum internalformat, GLuint buffer);
+#define glTexBuffer gl_stats_TexBuffer
+GLAPI void APIENTRY gl_stats_PrimitiveRestartIndex (GLuint index);
+#define glPrimitiveRestartIndex gl_stats_PrimitiveRestartIndex
+GLAPI void APIENTRY gl_stats_CopyBufferSubData (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+#define glCopyBufferSubData gl_stats_CopyBufferSubData
+GLAPI void APIENTRY gl_stats_GetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices);
+#define glGetUniformIndices gl_stats_GetUniformIndices
+GLAPI void APIENTRY gl_stats_GetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params);
+#define glGetActiveUniformsiv gl_stats_GetActiveUniformsiv
+GLAPI void APIENTRY gl_stats_GetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName);
+#define glGetActiveUniformName gl_stats_GetActiveUniformName
+GLAPI GLuint APIENTRY gl_stats_GetUniformBlockIndex (GLuint program, const GLchar *uniformBlockName);
+#define glGetUniformBlockIndex gl_stats_GetUniformBlockIndex
+GLAPI void APIENTRY gl_stats_GetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params);
+#define glGetActiveUniformBlockiv gl_stats_GetActiveUniformBlockiv
+GLAPI void APIENTRY gl_stats_GetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName);
+#define glGetActiveUniformBlockName gl_stats_GetActiveUniformBlockName
+GLAPI void APIENTRY gl_stats_UniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+#define glUniformBlockBinding gl_stats_UniformBlockBinding
+GLAPI void APIENTRY gl_stats_DrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+#define glDrawElementsBaseVertex gl_stats_DrawElementsBaseVertex
+GLAPI void APIENTRY gl_stats_DrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex);
+#define glDrawRangeElementsBaseVertex gl_stats_DrawRangeElementsBaseVertex
+GLAPI void APIENTRY gl_stats_DrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex);
+#define glDrawElementsInstancedBaseVertex gl_stats_DrawElementsInstancedBaseVertex
+GLAPI void APIENTRY gl_stats_MultiDrawElementsBaseVertex (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex);
+#define glMultiDrawElementsBaseVertex gl_stats_MultiDrawElementsBaseVertex
+GLAPI void APIENTRY gl_stats_ProvokingVertex (GLenum mode);
+#define glProvokingVertex gl_stats_ProvokingVertex
+GLAPI GLsync APIENTRY gl_stats_FenceSync (GLenum condition, GLbitfield flags);
+#define glFenceSync gl_stats_FenceSync
+GLAPI GLboolean APIENTRY gl_stats_IsSync (GLsync sync);
+#define glIsSync gl_stats_IsSync
+GLAPI void APIENTRY gl_stats_DeleteSync (GLsync sync);
+#define glDeleteSync gl_stats_DeleteSync
+GLAPI GLenum APIENTRY gl_stats_ClientWaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
+#define glClientWaitSync gl_stats_ClientWaitSync
+GLAPI void APIENTRY gl_stats_WaitSync (GLsync sync, GLbitfield flags, GLuint64 timeout);
+#define glWaitSync gl_stats_WaitSync
+GLAPI void APIENTRY gl_stats_GetInteger64v (GLenum pname, GLint64 *data);
+#define glGetInteger64v gl_stats_GetInteger64v
+GLAPI void APIENTRY gl_stats_GetSynciv (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values);
+#define glGetSynciv gl_stats_GetSynciv
+GLAPI void APIENTRY gl_stats_GetInteger64i_v (GLenum target, GLuint index, GLint64 *data);
+#define glGetInteger64i_v gl_stats_GetInteger64i_v
+GLAPI void APIENTRY gl_stats_GetBufferParameteri64v (GLenum target, GLenum pname, GLint64 *params);
+#define glGetBufferParameteri64v gl_stats_GetBufferParameteri64v
+GLAPI void APIENTRY gl_stats_FramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level);
+#define glFramebufferTexture gl_stats_FramebufferTexture
+GLAPI void APIENTRY gl_stats_TexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations);
+#define glTexImage2DMultisample gl_stats_TexImage2DMultisample
+GLAPI void APIENTRY gl_stats_TexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations);
+#define glTexImage3DMultisample gl_stats_TexImage3DMultisample
+GLAPI void APIENTRY gl_stats_GetMultisamplefv (GLenum pname, GLuint index, GLfloat *val);
+#define glGetMultisamplefv gl_stats_GetMultisamplefv
+GLAPI void APIENTRY gl_stats_SampleMaski (GLuint maskNumber, GLbitfield mask);
+#define glSampleMaski gl_stats_SampleMaski
+GLAPI void APIENTRY gl_stats_BindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name);
+#define glBindFragDataLocationIndexed gl_stats_BindFragDataLocationIndexed
+GLAPI GLint APIENTRY gl_stats_GetFragDataIndex (GLuint program, const GLchar *name);
+#define glGetFragDataIndex gl_stats_GetFragDataIndex
+GLAPI void APIENTRY gl_stats_GenSamplers (GLsizei count, GLuint *samplers);
+#define glGenSamplers gl_stats_GenSamplers
+GLAPI void APIENTRY gl_stats_DeleteSamplers (GLsizei count, const GLuint *samplers);
+#define glDeleteSamplers gl_stats_DeleteSamplers
+GLAPI GLboolean APIENTRY gl_stats_IsSampler (GLuint sampler);
+#define glIsSampler gl_stats_IsSampler
+GLAPI void APIENTRY gl_stats_BindSampler (GLuint unit, GLuint sampler);
+#define glBindSampler gl_stats_BindSampler
+GLAPI void APIENTRY gl_stats_SamplerParameteri (GLuint sampler, GLenum pname, GLint param);
+#define glSamplerParameteri gl_stats_SamplerParameteri
+GLAPI void APIENTRY gl_stats_SamplerParameteriv (GLuint sampler, GLenum pname, const GLint *param);
+#define glSamplerParameteriv gl_stats_SamplerParameteriv
+GLAPI void APIENTRY gl_stats_SamplerParameterf (GLuint sampler, GLenum pname, GLfloat param);
+#define glSamplerParameterf gl_stats_SamplerParameterf
+GLAPI void APIENTRY gl_stats_SamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat *param);
+#define glSamplerParameterfv gl_stats_SamplerParameterfv
+GLAPI void APIENTRY gl_stats_SamplerParameterIiv (GLuint sampler, GLenum pname, const GLint *param);
+#define glSamplerParameterIiv gl_stats_SamplerParameterIiv
+GLAPI void APIENTRY gl_stats_SamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint *param);
+#define glSamplerParameterIuiv gl_stats_SamplerParameterIuiv
+GLAPI void APIENTRY gl_stats_GetSamplerParameteriv (GLuint sampler, GLenum pname, GLint *params);
+#define glGetSamplerParameteriv gl_stats_GetSamplerParameteriv
+GLAPI void APIENTRY gl_stats_GetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint *params);
+#define glGetSamplerParameterIiv gl_stats_GetSamplerParameterIiv
+GLAPI void APIENTRY gl_stats_GetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat *params);
+#define glGetSamplerParameterfv gl_stats_GetSamplerParameterfv
+GLAPI void APIENTRY gl_stats_GetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint *params);
+#define glGetSamplerParameterIuiv gl_stats_GetSamplerParameterIuiv
+GLAPI void APIENTRY gl_stats_QueryCounter (GLuint id, GLenum target);
+#define glQueryCounter gl_stats_QueryCounter
+GLAPI void APIENTRY gl_stats_GetQueryObjecti64v (GLuint id, GLenum pname, GLint64 *params);
+#define glGetQueryObjecti64v gl_stats_GetQueryObjecti64v
+GLAPI void APIENTRY gl_stats_GetQueryObjectui64v (GLuint id, GLenum pname, GLuint64 *params);
+#define glGetQueryObjectui64v gl_stats_GetQueryObjectui64v
+GLAPI void APIENTRY gl_stats_VertexAttribDivisor (GLuint index, GLuint divisor);
+#define glVertexAttribDivisor gl_stats_VertexAttribDivisor
+GLAPI void APIENTRY gl_stats_VertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+#define glVertexAttribP1ui gl_stats_VertexAttribP1ui
+GLAPI void APIENTRY gl_stats_VertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+#define glVertexAttribP1uiv gl_stats_VertexAttribP1uiv
+GLAPI void APIENTRY gl_stats_VertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+#define glVertexAttribP2ui gl_stats_VertexAttribP2ui
+GLAPI void APIENTRY gl_stats_VertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+#define glVertexAttribP2uiv gl_stats_VertexAttribP2uiv
+GLAPI void APIENTRY gl_stats_VertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+#define glVertexAttribP3ui gl_stats_VertexAttribP3ui
+GLAPI void APIENTRY gl_stats_VertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+#define glVertexAttribP3uiv gl_stats_VertexAttribP3uiv
+GLAPI void APIENTRY gl_stats_VertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value);
+#define glVertexAttribP4ui gl_stats_VertexAttribP4ui
+GLAPI void APIENTRY gl_stats_VertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint *value);
+#define glVertexAttribP4uiv gl_stats_VertexAttribP4uiv
+
+}
+
+#endif //GL_DISPATCH_HPP
+
+#else
+
+GL_DISPATCH(void, CullFace, (GLenum mode), (mode))
+GL_DISPATCH(void, FrontFace, (GLenum mode), (mode))
+GL_DISPATCH(void, Hint, (GLenum target, GLenum mode), (target, mode))
+GL_DISPATCH(void, LineWidth, (GLfloat width), (width))
+GL_DISPATCH(void, PointSize, (GLfloat size), (size))
+GL_DISPATCH(void, PolygonMode, (GLenum face, GLenum mode), (face, mode))
+GL_DISPATCH(void, Scissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_DISPATCH(void, TexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+GL_DISPATCH(void, TexParameterfv, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params))
+GL_DISPATCH(void, TexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+GL_DISPATCH(void, TexParameteriv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_DISPATCH(void, TexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels))
+GL_DISPATCH(void, TexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+GL_DISPATCH(void, DrawBuffer, (GLenum buf), (buf))
+GL_DISPATCH(void, Clear, (GLbitfield mask), (mask))
+GL_DISPATCH(void, ClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_DISPATCH(void, ClearStencil, (GLint s), (s))
+GL_DISPATCH(void, ClearDepth, (GLdouble depth), (depth))
+GL_DISPATCH(void, StencilMask, (GLuint mask), (mask))
+GL_DISPATCH(void, ColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+GL_DISPATCH(void, DepthMask, (GLboolean flag), (flag))
+GL_DISPATCH(void, Disable, (GLenum cap), (cap))
+GL_DISPATCH(void, Enable, (GLenum cap), (cap))
+GL_DISPATCH(void, Finish, (void), ())
+GL_DISPATCH(void, Flush, (void), ())
+GL_DISPATCH(void, BlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+GL_DISPATCH(void, LogicOp, (GLenum opcode), (opcode))
+GL_DISPATCH(void, StencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+GL_DISPATCH(void, StencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+GL_DISPATCH(void, DepthFunc, (GLenum func), (func))
+GL_DISPATCH(void, PixelStoref, (GLenum pname, GLfloat param), (pname, param))
+GL_DISPATCH(void, PixelStorei, (GLenum pname, GLint param), (pname, param))
+GL_DISPATCH(void, ReadBuffer, (GLenum src), (src))
+GL_DISPATCH(void, ReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels))
+GL_DISPATCH(void, GetBooleanv, (GLenum pname, GLboolean *data), (pname, data))
+GL_DISPATCH(void, GetDoublev, (GLenum pname, GLdouble *data), (pname, data))
+GL_DISPATCH(GLenum, GetError, (void), ())
+GL_DISPATCH(void, GetFloatv, (GLenum pname, GLfloat *data), (pname, data))
+GL_DISPATCH(void, GetIntegerv, (GLenum pname, GLint *data), (pname, data))
+GL_DISPATCH(const GLubyte *, GetString, (GLenum name), (name))
+GL_DISPATCH(void, GetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels))
+GL_DISPATCH(void, GetTexParameterfv, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params))
+GL_DISPATCH(void, GetTexParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_DISPATCH(void, GetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params))
+GL_DISPATCH(void, GetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params))
+GL_DISPATCH(GLboolean, IsEnabled, (GLenum cap), (cap))
+GL_DISPATCH(void, DepthRange, (GLdouble near, GLdouble far), (near, far))
+GL_DISPATCH(void, Viewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+GL_DISPATCH(void, DrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+GL_DISPATCH(void, DrawElements, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices))
+GL_DISPATCH(void, GetPointerv, (GLenum pname, void **params), (pname, params))
+GL_DISPATCH(void, PolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+GL_DISPATCH(void, CopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+GL_DISPATCH(void, CopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+GL_DISPATCH(void, CopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+GL_DISPATCH(void, CopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+GL_DISPATCH(void, TexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels))
+GL_DISPATCH(void, TexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+GL_DISPATCH(void, BindTexture, (GLenum target, GLuint texture), (target, texture))
+GL_DISPATCH(void, DeleteTextures, (GLsizei n, const GLuint *textures), (n, textures))
+GL_DISPATCH(void, GenTextures, (GLsizei n, GLuint *textures), (n, textures))
+GL_DISPATCH(GLboolean, IsTexture, (GLuint texture), (texture))
+GL_DISPATCH(void, DrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices))
+GL_DISPATCH(void, TexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+GL_DISPATCH(void, TexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+GL_DISPATCH(void, CopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+GL_DISPATCH(void, ActiveTexture, (GLenum texture), (texture))
+GL_DISPATCH(void, SampleCoverage, (GLfloat value, GLboolean invert), (value, invert))
+GL_DISPATCH(void, CompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+GL_DISPATCH(void, CompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data))
+GL_DISPATCH(void, CompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data))
+GL_DISPATCH(void, CompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+GL_DISPATCH(void, CompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+GL_DISPATCH(void, CompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data))
+GL_DISPATCH(void, GetCompressedTexImage, (GLenum target, GLint level, void *img), (target, level, img))
+GL_DISPATCH(void, BlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+GL_DISPATCH(void, MultiDrawArrays, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount))
+GL_DISPATCH(void, MultiDrawElements, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+GL_DISPATCH(void, PointParameterf, (GLenum pname, GLfloat param), (pname, param))
+GL_DISPATCH(void, PointParameterfv, (GLenum pname, const GLfloat *params), (pname, params))
+GL_DISPATCH(void, PointParameteri, (GLenum pname, GLint param), (pname, param))
+GL_DISPATCH(void, PointParameteriv, (GLenum pname, const GLint *params), (pname, params))
+GL_DISPATCH(void, BlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+GL_DISPATCH(void, BlendEquation, (GLenum mode), (mode))
+GL_DISPATCH(void, GenQueries, (GLsizei n, GLuint *ids), (n, ids))
+GL_DISPATCH(void, DeleteQueries, (GLsizei n, const GLuint *ids), (n, ids))
+GL_DISPATCH(GLboolean, IsQuery, (GLuint id), (id))
+GL_DISPATCH(void, BeginQuery, (GLenum target, GLuint id), (target, id))
+GL_DISPATCH(void, EndQuery, (GLenum target), (target))
+GL_DISPATCH(void, GetQueryiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_DISPATCH(void, GetQueryObjectiv, (GLuint id, GLenum pname, GLint *params), (id, pname, params))
+GL_DISPATCH(void, GetQueryObjectuiv, (GLuint id, GLenum pname, GLuint *params), (id, pname, params))
+GL_DISPATCH(void, BindBuffer, (GLenum target, GLuint buffer), (target, buffer))
+GL_DISPATCH(void, DeleteBuffers, (GLsizei n, const GLuint *buffers), (n, buffers))
+GL_DISPATCH(void, GenBuffers, (GLsizei n, GLuint *buffers), (n, buffers))
+GL_DISPATCH(GLboolean, IsBuffer, (GLuint buffer), (buffer))
+GL_DISPATCH(void, BufferData, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage))
+GL_DISPATCH(void, BufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data))
+GL_DISPATCH(void, GetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data))
+GL_DISPATCH(void *, MapBuffer, (GLenum target, GLenum access), (target, access))
+GL_DISPATCH(GLboolean, UnmapBuffer, (GLenum target), (target))
+GL_DISPATCH(void, GetBufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_DISPATCH(void, GetBufferPointerv, (GLenum target, GLenum pname, void **params), (target, pname, params))
+GL_DISPATCH(void, BlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+GL_DISPATCH(void, DrawBuffers, (GLsizei n, const GLenum *bufs), (n, bufs))
+GL_DISPATCH(void, StencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+GL_DISPATCH(void, StencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+GL_DISPATCH(void, StencilMaskSeparate, (GLenum face, GLuint mask), (face, mask))
+GL_DISPATCH(void, AttachShader, (GLuint program, GLuint shader), (program, shader))
+GL_DISPATCH(void, BindAttribLocation, (GLuint program, GLuint index, const GLchar *name), (program, index, name))
+GL_DISPATCH(void, CompileShader, (GLuint shader), (shader))
+GL_DISPATCH(GLuint, CreateProgram, (void), ())
+GL_DISPATCH(GLuint, CreateShader, (GLenum type), (type))
+GL_DISPATCH(void, DeleteProgram, (GLuint program), (program))
+GL_DISPATCH(void, DeleteShader, (GLuint shader), (shader))
+GL_DISPATCH(void, DetachShader, (GLuint program, GLuint shader), (program, shader))
+GL_DISPATCH(void, DisableVertexAttribArray, (GLuint index), (index))
+GL_DISPATCH(void, EnableVertexAttribArray, (GLuint index), (index))
+GL_DISPATCH(void, GetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_DISPATCH(void, GetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_DISPATCH(void, GetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders))
+GL_DISPATCH(GLint, GetAttribLocation, (GLuint program, const GLchar *name), (program, name))
+GL_DISPATCH(void, GetProgramiv, (GLuint program, GLenum pname, GLint *params), (program, pname, params))
+GL_DISPATCH(void, GetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog))
+GL_DISPATCH(void, GetShaderiv, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params))
+GL_DISPATCH(void, GetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog))
+GL_DISPATCH(void, GetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source))
+GL_DISPATCH(GLint, GetUniformLocation, (GLuint program, const GLchar *name), (program, name))
+GL_DISPATCH(void, GetUniformfv, (GLuint program, GLint location, GLfloat *params), (program, location, params))
+GL_DISPATCH(void, GetUniformiv, (GLuint program, GLint location, GLint *params), (program, location, params))
+GL_DISPATCH(void, GetVertexAttribdv, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params))
+GL_DISPATCH(void, GetVertexAttribfv, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params))
+GL_DISPATCH(void, GetVertexAttribiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_DISPATCH(void, GetVertexAttribPointerv, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer))
+GL_DISPATCH(GLboolean, IsProgram, (GLuint program), (program))
+GL_DISPATCH(GLboolean, IsShader, (GLuint shader), (shader))
+GL_DISPATCH(void, LinkProgram, (GLuint program), (program))
+GL_DISPATCH(void, ShaderSource, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length))
+GL_DISPATCH(void, UseProgram, (GLuint program), (program))
+GL_DISPATCH(void, Uniform1f, (GLint location, GLfloat v0), (location, v0))
+GL_DISPATCH(void, Uniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+GL_DISPATCH(void, Uniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+GL_DISPATCH(void, Uniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+GL_DISPATCH(void, Uniform1i, (GLint location, GLint v0), (location, v0))
+GL_DISPATCH(void, Uniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+GL_DISPATCH(void, Uniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+GL_DISPATCH(void, Uniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+GL_DISPATCH(void, Uniform1fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_DISPATCH(void, Uniform2fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_DISPATCH(void, Uniform3fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_DISPATCH(void, Uniform4fv, (GLint location, GLsizei count, const GLfloat *value), (location, count, value))
+GL_DISPATCH(void, Uniform1iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_DISPATCH(void, Uniform2iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_DISPATCH(void, Uniform3iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_DISPATCH(void, Uniform4iv, (GLint location, GLsizei count, const GLint *value), (location, count, value))
+GL_DISPATCH(void, UniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, ValidateProgram, (GLuint program), (program))
+GL_DISPATCH(void, VertexAttrib1d, (GLuint index, GLdouble x), (index, x))
+GL_DISPATCH(void, VertexAttrib1dv, (GLuint index, const GLdouble *v), (index, v))
+GL_DISPATCH(void, VertexAttrib1f, (GLuint index, GLfloat x), (index, x))
+GL_DISPATCH(void, VertexAttrib1fv, (GLuint index, const GLfloat *v), (index, v))
+GL_DISPATCH(void, VertexAttrib1s, (GLuint index, GLshort x), (index, x))
+GL_DISPATCH(void, VertexAttrib1sv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+GL_DISPATCH(void, VertexAttrib2dv, (GLuint index, const GLdouble *v), (index, v))
+GL_DISPATCH(void, VertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+GL_DISPATCH(void, VertexAttrib2fv, (GLuint index, const GLfloat *v), (index, v))
+GL_DISPATCH(void, VertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y))
+GL_DISPATCH(void, VertexAttrib2sv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+GL_DISPATCH(void, VertexAttrib3dv, (GLuint index, const GLdouble *v), (index, v))
+GL_DISPATCH(void, VertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+GL_DISPATCH(void, VertexAttrib3fv, (GLuint index, const GLfloat *v), (index, v))
+GL_DISPATCH(void, VertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+GL_DISPATCH(void, VertexAttrib3sv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Nbv, (GLuint index, const GLbyte *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Niv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Nsv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttrib4Nubv, (GLuint index, const GLubyte *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Nuiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4Nusv, (GLuint index, const GLushort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4bv, (GLuint index, const GLbyte *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttrib4dv, (GLuint index, const GLdouble *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttrib4fv, (GLuint index, const GLfloat *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4iv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttrib4sv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4ubv, (GLuint index, const GLubyte *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4uiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttrib4usv, (GLuint index, const GLushort *v), (index, v))
+GL_DISPATCH(void, VertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer))
+GL_DISPATCH(void, UniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, UniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value))
+GL_DISPATCH(void, ColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+GL_DISPATCH(void, GetBooleani_v, (GLenum target, GLuint index, GLboolean *data), (target, index, data))
+GL_DISPATCH(void, GetIntegeri_v, (GLenum target, GLuint index, GLint *data), (target, index, data))
+GL_DISPATCH(void, Enablei, (GLenum target, GLuint index), (target, index))
+GL_DISPATCH(void, Disablei, (GLenum target, GLuint index), (target, index))
+GL_DISPATCH(GLboolean, IsEnabledi, (GLenum target, GLuint index), (target, index))
+GL_DISPATCH(void, BeginTransformFeedback, (GLenum primitiveMode), (primitiveMode))
+GL_DISPATCH(void, EndTransformFeedback, (void), ())
+GL_DISPATCH(void, BindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+GL_DISPATCH(void, BindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+GL_DISPATCH(void, TransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+GL_DISPATCH(void, GetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name))
+GL_DISPATCH(void, ClampColor, (GLenum target, GLenum clamp), (target, clamp))
+GL_DISPATCH(void, BeginConditionalRender, (GLuint id, GLenum mode), (id, mode))
+GL_DISPATCH(void, EndConditionalRender, (void), ())
+GL_DISPATCH(void, VertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer))
+GL_DISPATCH(void, GetVertexAttribIiv, (GLuint index, GLenum pname, GLint *params), (index, pname, params))
+GL_DISPATCH(void, GetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint *params), (index, pname, params))
+GL_DISPATCH(void, VertexAttribI1i, (GLuint index, GLint x), (index, x))
+GL_DISPATCH(void, VertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y))
+GL_DISPATCH(void, VertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+GL_DISPATCH(void, VertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttribI1ui, (GLuint index, GLuint x), (index, x))
+GL_DISPATCH(void, VertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y))
+GL_DISPATCH(void, VertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+GL_DISPATCH(void, VertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+GL_DISPATCH(void, VertexAttribI1iv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI2iv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI3iv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4iv, (GLuint index, const GLint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI1uiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI2uiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI3uiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4uiv, (GLuint index, const GLuint *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4bv, (GLuint index, const GLbyte *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4sv, (GLuint index, const GLshort *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4ubv, (GLuint index, const GLubyte *v), (index, v))
+GL_DISPATCH(void, VertexAttribI4usv, (GLuint index, const GLushort *v), (index, v))
+GL_DISPATCH(void, GetUniformuiv, (GLuint program, GLint location, GLuint *params), (program, location, params))
+GL_DISPATCH(void, BindFragDataLocation, (GLuint program, GLuint color, const GLchar *name), (program, color, name))
+GL_DISPATCH(GLint, GetFragDataLocation, (GLuint program, const GLchar *name), (program, name))
+GL_DISPATCH(void, Uniform1ui, (GLint location, GLuint v0), (location, v0))
+GL_DISPATCH(void, Uniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+GL_DISPATCH(void, Uniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+GL_DISPATCH(void, Uniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+GL_DISPATCH(void, Uniform1uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_DISPATCH(void, Uniform2uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_DISPATCH(void, Uniform3uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_DISPATCH(void, Uniform4uiv, (GLint location, GLsizei count, const GLuint *value), (location, count, value))
+GL_DISPATCH(void, TexParameterIiv, (GLenum target, GLenum pname, const GLint *params), (target, pname, params))
+GL_DISPATCH(void, TexParameterIuiv, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params))
+GL_DISPATCH(void, GetTexParameterIiv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_DISPATCH(void, GetTexParameterIuiv, (GLenum target, GLenum pname, GLuint *params), (target, pname, params))
+GL_DISPATCH(void, ClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value))
+GL_DISPATCH(void, ClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value))
+GL_DISPATCH(void, ClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value))
+GL_DISPATCH(void, ClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+GL_DISPATCH(const GLubyte *, GetStringi, (GLenum name, GLuint index), (name, index))
+GL_DISPATCH(GLboolean, IsRenderbuffer, (GLuint renderbuffer), (renderbuffer))
+GL_DISPATCH(void, BindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+GL_DISPATCH(void, DeleteRenderbuffers, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers))
+GL_DISPATCH(void, GenRenderbuffers, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers))
+GL_DISPATCH(void, RenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+GL_DISPATCH(void, GetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint *params), (target, pname, params))
+GL_DISPATCH(GLboolean, IsFramebuffer, (GLuint framebuffer), (framebuffer))
+GL_DISPATCH(void, BindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+GL_DISPATCH(void, DeleteFramebuffers, (GLsizei n, const GLuint *framebuffers), (n, framebuffers))
+GL_DISPATCH(void, GenFramebuffers, (GLsizei n, GLuint *framebuffers), (n, framebuffers))
+GL_DISPATCH(GLenum, CheckFramebufferStatus, (GLenum target), (target))
+GL_DISPATCH(void, FramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_DISPATCH(void, FramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+GL_DISPATCH(void, FramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+GL_DISPATCH(void, FramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+GL_DISPATCH(void, GetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params))
+GL_DISPATCH(void, GenerateMipmap, (GLenum target), (target))
+GL_DISPATCH(void, BlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+GL_DISPATCH(void, RenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+GL_DISPATCH(void, FramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+GL_DISPATCH(void *, MapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+GL_DISPATCH(void, FlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+GL_DISPATCH(void, BindVertexArray, (GLuint array), (array))
+GL_DISPATCH(void, DeleteVertexArrays, (GLsizei n, const GLuint *arrays), (n, arrays))
+GL_DISPATCH(void, GenVertexArrays, (GLsizei n, GLuint *arrays), (n, arrays))
+GL_DISPATCH(GLboolean, IsVertexArray, (GLuint array), (array))
+GL_DISPATCH(void, DrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+GL_DISPATCH(void, DrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+GL_DISPATCH(void, TexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+GL_DISPATCH(void, PrimitiveRestartIndex, (GLuint index), (index))
+GL_DISPATCH(void, CopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+GL_DISPATCH(void, GetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+GL_DISPATCH(void, GetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params))
+GL_DISPATCH(void, GetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName))
+GL_DISPATCH(GLuint, GetUniformBlockIndex, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName))
+GL_DISPATCH(void, GetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params))
+GL_DISPATCH(void, GetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+GL_DISPATCH(void, UniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+GL_DISPATCH(void, DrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex))
+GL_DISPATCH(void, DrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+GL_DISPATCH(void, DrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+GL_DISPATCH(void, MultiDrawElementsBaseVertex, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex))
+GL_DISPATCH(void, ProvokingVertex, (GLenum mode), (mode))
+GL_DISPATCH(GLsync, FenceSync, (GLenum condition, GLbitfield flags), (condition, flags))
+GL_DISPATCH(GLboolean, IsSync, (GLsync sync), (sync))
+GL_DISPATCH(void, DeleteSync, (GLsync sync), (sync))
+GL_DISPATCH(GLenum, ClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_DISPATCH(void, WaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+GL_DISPATCH(void, GetInteger64v, (GLenum pname, GLint64 *data), (pname, data))
+GL_DISPATCH(void, GetSynciv, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (sync, pname, bufSize, length, values))
+GL_DISPATCH(void, GetInteger64i_v, (GLenum target, GLuint index, GLint64 *data), (target, index, data))
+GL_DISPATCH(void, GetBufferParameteri64v, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params))
+GL_DISPATCH(void, FramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+GL_DISPATCH(void, TexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+GL_DISPATCH(void, TexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+GL_DISPATCH(void, GetMultisamplefv, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val))
+GL_DISPATCH(void, SampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+GL_DISPATCH(void, BindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name))
+GL_DISPATCH(GLint, GetFragDataIndex, (GLuint program, const GLchar *name), (program, name))
+GL_DISPATCH(void, GenSamplers, (GLsizei count, GLuint *samplers), (count, samplers))
+GL_DISPATCH(void, DeleteSamplers, (GLsizei count, const GLuint *samplers), (count, samplers))
+GL_DISPATCH(GLboolean, IsSampler, (GLuint sampler), (sampler))
+GL_DISPATCH(void, BindSampler, (GLuint unit, GLuint sampler), (unit, sampler))
+GL_DISPATCH(void, SamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+GL_DISPATCH(void, SamplerParameteriv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GL_DISPATCH(void, SamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+GL_DISPATCH(void, SamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param))
+GL_DISPATCH(void, SamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param))
+GL_DISPATCH(void, SamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param))
+GL_DISPATCH(void, GetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GL_DISPATCH(void, GetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params))
+GL_DISPATCH(void, GetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params))
+GL_DISPATCH(void, GetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params))
+GL_DISPATCH(void, QueryCounter, (GLuint id, GLenum target), (id, target))
+GL_DISPATCH(void, GetQueryObjecti64v, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params))
+GL_DISPATCH(void, GetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params))
+GL_DISPATCH(void, VertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+GL_DISPATCH(void, VertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+GL_DISPATCH(void, VertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value))
+
+#endif //GL_DISPATCH
@@ -0,0 +1,351 @@
+// the real entry points; gl_dispatch.hpp is only used below as a list of wrappers to define:
+#define GL_GLEXT_PROTOTYPES 1
+#include "glcorearb.h"
+#include "gl_stats.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+namespace {
+
+enum Call : uint32_t {
+#define GL_DISPATCH(RETURN, NAME, PARAMS, ARGS) CALL_##NAME,
+#include "gl_dispatch.hpp"
+#undef GL_DISPATCH
+	CALL_COUNT
+};
+
+char const* const CALL_NAMES[CALL_COUNT] = {
+#define GL_DISPATCH(RETURN, NAME, PARAMS, ARGS) "gl" #NAME,
+#include "gl_dispatch.hpp"
+#undef GL_DISPATCH
+};
+
+struct Counts {
+	std::array<uint64_t, CALL_COUNT> calls;
+	std::array<uint64_t, CALL_COUNT> redundant;
+	uint64_t bytes_uploaded = 0;
+	Counts() {
+		calls.fill(0);
+		redundant.fill(0);
+	}
+};
+// per thread, like the contexts they count calls on (see gl_stats.hpp):
+thread_local Counts counts;
+uint64_t frame = 0;
+
+// what the wrappers have seen set; state missing from a map (or not 'known') hasn't been set yet:
+struct Shadow {
+	GLuint program = 0;
+	GLuint vertex_array = 0;
+	GLenum active_texture = GL_TEXTURE0;
+	std::map<std::pair<GLenum, GLenum>, GLuint> textures; // by (unit, target)
+	std::map<GLenum, GLuint> buffers;                      // by target; the element buffer is vertex array state
+	GLuint draw_framebuffer = 0;
+	GLuint read_framebuffer = 0;
+	std::map<GLenum, bool> enabled;
+	std::array<GLenum, 2> blend_func = {{GL_ONE, GL_ZERO}};
+	std::array<GLfloat, 4> clear_color = {{0.0f, 0.0f, 0.0f, 0.0f}};
+	std::array<GLint, 4> viewport = {{0, 0, 0, 0}};
+	bool viewport_known = false;
+};
+thread_local Shadow shadow;
+
+// stores 'value' and returns whether it was already there:
+template< typename T >
+bool same(T* state, T const& value) {
+	bool was = *state == value;
+	*state = value;
+	return was;
+}
+
+template< typename K >
+bool same_in(std::map< K, GLuint >* states, K const& key, GLuint value) {
+	auto found = states->find(key);
+	bool was = found != states->end() && found->second == value;
+	(*states)[key] = value;
+	return was;
+}
+
+// bindings of deleted objects revert to 0:
+void forget(GLsizei n, GLuint const* names, GLuint* binding) {
+	if (std::find(names, names + n, *binding) != names + n) {
+		*binding = 0;
+	}
+}
+template< typename K >
+void forget(GLsizei n, GLuint const* names, std::map< K, GLuint >* bindings) {
+	for (auto& binding : *bindings) {
+		forget(n, names, &binding.second);
+	}
+}
+
+size_t pixel_bytes(GLenum format, GLenum type) {
+	size_t components = format == GL_RED || format == GL_RED_INTEGER || format == GL_DEPTH_COMPONENT ? 1
+			: format == GL_RG || format == GL_RG_INTEGER || format == GL_DEPTH_STENCIL ? 2
+			: format == GL_RGB || format == GL_BGR || format == GL_RGB_INTEGER ? 3
+			: 4;
+	switch (type) {
+		case GL_UNSIGNED_BYTE:
+		case GL_BYTE:
+			return components;
+		case GL_UNSIGNED_SHORT:
+		case GL_SHORT:
+		case GL_HALF_FLOAT:
+			return components * 2;
+		case GL_UNSIGNED_INT:
+		case GL_INT:
+		case GL_FLOAT:
+			return components * 4;
+		default: // packed formats hold a whole pixel
+			return type == GL_UNSIGNED_SHORT_5_6_5 || type == GL_UNSIGNED_SHORT_4_4_4_4 || type == GL_UNSIGNED_SHORT_5_5_5_1 ? 2 : 4;
+	}
+}
+
+void uploaded(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void const* pixels) {
+	if (pixels) {
+		counts.bytes_uploaded += size_t(width) * height * depth * pixel_bytes(format, type);
+	}
+}
+
+// Observe<CALL_X>::call(arguments...) runs before glX is called and returns true if the
+// call is a redundant state change. Most calls are only counted:
+template< Call C >
+struct Observe {
+	template< typename... Args >
+	static bool call(Args...) {
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_UseProgram > {
+	static bool call(GLuint program) { return same(&shadow.program, program); }
+};
+
+template<>
+struct Observe< CALL_BindVertexArray > {
+	static bool call(GLuint array) {
+		bool was = same(&shadow.vertex_array, array);
+		if (!was) {
+			shadow.buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+		}
+		return was;
+	}
+};
+
+template<>
+struct Observe< CALL_ActiveTexture > {
+	static bool call(GLenum texture) { return same(&shadow.active_texture, texture); }
+};
+
+template<>
+struct Observe< CALL_BindTexture > {
+	static bool call(GLenum target, GLuint texture) {
+		return same_in(&shadow.textures, std::make_pair(shadow.active_texture, target), texture);
+	}
+};
+
+template<>
+struct Observe< CALL_BindBuffer > {
+	static bool call(GLenum target, GLuint buffer) { return same_in(&shadow.buffers, target, buffer); }
+};
+
+template<>
+struct Observe< CALL_BindFramebuffer > {
+	static bool call(GLenum target, GLuint framebuffer) {
+		bool draw = target == GL_READ_FRAMEBUFFER || same(&shadow.draw_framebuffer, framebuffer);
+		bool read = target == GL_DRAW_FRAMEBUFFER || same(&shadow.read_framebuffer, framebuffer);
+		return draw && read;
+	}
+};
+
+template<>
+struct Observe< CALL_Enable > {
+	static bool call(GLenum cap) {
+		auto found = shadow.enabled.find(cap);
+		bool was = found != shadow.enabled.end() && found->second;
+		shadow.enabled[cap] = true;
+		return was;
+	}
+};
+
+template<>
+struct Observe< CALL_Disable > {
+	static bool call(GLenum cap) {
+		auto found = shadow.enabled.find(cap);
+		bool was = found != shadow.enabled.end() && !found->second;
+		shadow.enabled[cap] = false;
+		return was;
+	}
+};
+
+template<>
+struct Observe< CALL_BlendFunc > {
+	static bool call(GLenum sfactor, GLenum dfactor) {
+		return same(&shadow.blend_func, std::array< GLenum, 2 >{{sfactor, dfactor}});
+	}
+};
+
+template<>
+struct Observe< CALL_ClearColor > {
+	static bool call(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+		return same(&shadow.clear_color, std::array< GLfloat, 4 >{{red, green, blue, alpha}});
+	}
+};
+
+template<>
+struct Observe< CALL_Viewport > {
+	static bool call(GLint x, GLint y, GLsizei width, GLsizei height) {
+		bool was = same(&shadow.viewport, std::array< GLint, 4 >{{x, y, width, height}}) && shadow.viewport_known;
+		shadow.viewport_known = true;
+		return was;
+	}
+};
+
+template<>
+struct Observe< CALL_BufferData > {
+	static bool call(GLenum, GLsizeiptr size, void const* data, GLenum) {
+		counts.bytes_uploaded += data ? size : 0;
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_BufferSubData > {
+	static bool call(GLenum, GLintptr, GLsizeiptr size, void const*) {
+		counts.bytes_uploaded += size;
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_TexImage2D > {
+	static bool call(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type,
+									 void const* pixels) {
+		uploaded(width, height, 1, format, type, pixels);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_TexImage3D > {
+	static bool call(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLint, GLenum format, GLenum type,
+									 void const* pixels) {
+		uploaded(width, height, depth, format, type, pixels);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_TexSubImage2D > {
+	static bool call(GLenum, GLint, GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type,
+									 void const* pixels) {
+		uploaded(width, height, 1, format, type, pixels);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_TexSubImage3D > {
+	static bool call(GLenum, GLint, GLint, GLint, GLint, GLsizei width, GLsizei height, GLsizei depth, GLenum format,
+									 GLenum type, void const* pixels) {
+		uploaded(width, height, depth, format, type, pixels);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_DeleteTextures > {
+	static bool call(GLsizei n, GLuint const* textures) {
+		forget(n, textures, &shadow.textures);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_DeleteBuffers > {
+	static bool call(GLsizei n, GLuint const* buffers) {
+		forget(n, buffers, &shadow.buffers);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_DeleteVertexArrays > {
+	static bool call(GLsizei n, GLuint const* arrays) {
+		forget(n, arrays, &shadow.vertex_array);
+		return false;
+	}
+};
+
+template<>
+struct Observe< CALL_DeleteFramebuffers > {
+	static bool call(GLsizei n, GLuint const* framebuffers) {
+		forget(n, framebuffers, &shadow.draw_framebuffer);
+		forget(n, framebuffers, &shadow.read_framebuffer);
+		return false;
+	}
+};
+
+} // namespace
+
+#define GL_DISPATCH(RETURN, NAME, PARAMS, ARGS)            \
+	extern "C" RETURN APIENTRY gl_stats_##NAME PARAMS {     \
+		++counts.calls[CALL_##NAME];                           \
+		if (Observe< CALL_##NAME >::call ARGS) {               \
+			++counts.redundant[CALL_##NAME];                     \
+		}                                                      \
+		return gl##NAME ARGS;                                  \
+	}
+#include "gl_dispatch.hpp"
+#undef GL_DISPATCH
+
+void gl_stats_end_frame() {
+	static std::ofstream file;
+	static bool opened = false;
+	if (!opened) {
+		opened = true;
+		if (char const* filename = std::getenv("GL_STATS_FILE")) {
+			file.open(filename);
+			if (!file) {
+				std::cerr << "Failed to open GL stats file '" << filename << "', using stderr." << std::endl;
+			}
+		}
+	}
+	std::ostream& out = file.is_open() ? static_cast< std::ostream& >(file) : std::cerr;
+
+	// most called first:
+	std::vector< uint32_t > order;
+	uint64_t calls = 0;
+	uint64_t redundant = 0;
+	for (uint32_t c = 0; c < CALL_COUNT; ++c) {
+		if (counts.calls[c]) {
+			order.emplace_back(c);
+		}
+		calls += counts.calls[c];
+		redundant += counts.redundant[c];
+	}
+	std::stable_sort(order.begin(), order.end(),
+									 [](uint32_t a, uint32_t b) { return counts.calls[a] > counts.calls[b]; });
+
+	out << "GL frame " << frame << ": " << calls << " calls, " << redundant << " redundant, " << counts.bytes_uploaded
+			<< " bytes uploaded |";
+	for (uint32_t c : order) {
+		out << " " << CALL_NAMES[c] << " " << counts.calls[c];
+		if (counts.redundant[c]) {
+			out << " (" << counts.redundant[c] << " redundant)";
+		}
+	}
+	out << std::endl;
+
+	counts = Counts();
+	++frame;
+}
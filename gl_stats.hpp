@@ -0,0 +1,18 @@
+#pragma once
+
+/*
+ * GL call instrumentation for Linux builds, enabled with jam -sGL_STATS=1 (which defines
+ * GL_STATS). GL.hpp then includes gl_dispatch.hpp, generated by make-gl-shims.py, which
+ * sends every gl* call through a wrapper in gl_stats.cpp. The wrappers count calls,
+ * redundant state changes and bytes uploaded. A state change is redundant if it sets
+ * what is already set: binding the bound program, vertex array, texture, buffer or
+ * framebuffer, enabling an enabled capability, or repeating the active texture unit,
+ * blend function, clear color or viewport. Counts and the state they compare against are
+ * kept per thread, as each thread draws or compiles on its own context; calls made by
+ * ShaderLibrary's background thread are counted there and never reported.
+ */
+
+// write the calling thread's counts since the last call as one line, then zero them. Output goes to the file
+// named by the GL_STATS_FILE environment variable if it is set, otherwise to stderr.
+// Call once per frame:
+void gl_stats_end_frame();
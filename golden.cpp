@@ -0,0 +1,435 @@
+#include "config.hpp"
+#include "level.hpp"
+#include "region_streamer.hpp"
+#include "game.hpp"
+#include "renderer.hpp"
+#include "software_renderer.hpp"
+#include "load_save_png.hpp"
+#include "GL.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * Render regression tests. Each scene sets up a fresh Game, by walking it with scripted
+ * buttons or by setting its state directly, then draws it in a hidden window at a fixed
+ * timestep. The last frame is compared with golden/<scene>.png (golden/compact/<scene>.png
+ * in COMPACT_VERTICES builds), and the frame's draw calls and vertices are checked against
+ * golden/budgets.txt. Any difference or overrun fails the run. The median frame time (update,
+ * draw and glFinish) is reported too, but depends on the machine, so it is only checked with
+ * --check-times. The window is hidden but still needs a real OpenGL 3.3 context, so this only
+ * runs where one can be created (a GPU, or a software GL driver); --software needs neither.
+ * Run from the repository root: dist/golden [--update] [--check-times] [--metrics file] | --software
+ *  --update rewrites the images and the draw call and vertex budgets from this run
+ *    (frame time budgets are kept; new scenes get their median frame time times FRAME_MARGIN).
+ *  --check-times also fails scenes over their frame time budget; only meaningful on the
+ *    machine the budgets were measured on.
+ *  --metrics appends this run's numbers to 'file', one line per scene, in the budgets format.
+ *  --software draws each scene's last frame with SoftwareRenderer instead, with no window
+ *    or GL context, and only compares images (within SOFTWARE_TOLERANCE).
+ */
+
+namespace {
+
+const float DT = 1.0f / 60.0f;
+const uint32_t FRAMES = 30; // drawn after a scene's script; the first WARMUP aren't timed
+const uint32_t WARMUP = 10;
+const uint32_t TOLERANCE = 2; // per channel, for drivers that round differently
+// SoftwareRenderer filters the hint's distance field a little differently (up to 9 apart, measured), and picks the
+// neighbouring texel where a pixel center falls on a texel edge (up to 64 pixels a scene, measured):
+const uint32_t SOFTWARE_TOLERANCE = 16;
+const uint32_t SOFTWARE_DIFFERING = 128; // pixels allowed past SOFTWARE_TOLERANCE
+const float FRAME_MARGIN = 1.5f; // frame time budgets over the measured median, for timing noise
+const std::string DIRECTORY = "golden";
+const std::string BUDGETS = DIRECTORY + "/budgets.txt";
+// the compact vertex layout quantizes positions and colors, so its frames differ slightly and have their own images:
+#ifdef COMPACT_VERTICES
+const std::string IMAGES = DIRECTORY + "/compact";
+#else
+const std::string IMAGES = DIRECTORY;
+#endif
+
+const char* BUDGETS_HEADER =
+		"# scene, then the most draw calls and vertices of its last frame, and its longest median frame time (ms).\n"
+		"# Draw call and vertex budgets are exact, with no headroom: they are the counts of the last 'dist/golden --update',\n"
+		"# so any extra call or vertex fails. Frame times are only checked with --check-times, kept by --update and edited\n"
+		"# by hand: each is the slowest median of six runs on the machine the images come from, times 1.5 (new scenes get\n"
+		"# theirs from one run).\n";
+
+// buttons held for some ticks:
+struct Step {
+	uint8_t buttons;
+	uint32_t ticks;
+};
+
+struct Scene {
+	std::string name;
+	std::function< void(Game&) > setup;
+	std::vector< Step > script;
+};
+
+struct Budget {
+	uint32_t draw_calls = 0;
+	uint32_t vertices = 0;
+	float frame_ms = 0.0f;
+};
+
+// put the player at 'at' in 'region', and let a still tick move the camera there:
+void place(Game& game, std::string const& region, glm::vec2 const& at) {
+	game.enter_region(region_named(game.level, region));
+	game.player.at = at;
+	game.update(0, 0.0f);
+}
+
+std::vector< Scene > scenes() {
+	std::vector< Scene > list;
+	list.push_back(Scene{"start", [](Game&) {}, {}});
+	list.push_back(Scene{"left", [](Game& game) { place(game, "map_left", glm::vec2(0.0f, -6.0f)); }, {}});
+	list.push_back(Scene{"right", [](Game& game) { place(game, "map_right", glm::vec2(0.0f, -6.0f)); }, {}});
+	// from the start into the right region, streaming it in on the way:
+	list.push_back(Scene{"walk_right", [](Game&) {}, {{BUTTON_RIGHT, 120}}});
+	// to the knife (one unit up and right of the start), and picking it up:
+	list.push_back(Scene{"carrying", [](Game&) {}, {{BUTTON_RIGHT, 6}, {BUTTON_UP, 7}, {BUTTON_INTERACT, 1}, {0, 1}}});
+	list.push_back(Scene{"tools", [](Game& game) {
+		for (Game::Recipe& recipe : game.recipes) {
+			recipe.built = true;
+		}
+		game.hasBridge = game.hasPickaxe = game.hasKnife = true;
+		place(game, "map_left", glm::vec2(-3.4f, -1.0f));
+	}, {}});
+	list.push_back(Scene{"win", [](Game& game) {
+		for (Game::Pillar& pillar : game.pillars) {
+			pillar.filled = true;
+		}
+		place(game, "map_middle", glm::vec2(0.0f, -6.0f));
+	}, {}});
+	list.push_back(Scene{"long_hint", [](Game& game) {
+		game.hint = "THIS HINT GOES ON AND ON, PAST THE EDGE OF THE WINDOW!";
+		game.hintTimer = 0.0f;
+	}, {}});
+	return list;
+}
+
+// scene name to budget; missing file or scenes are empty:
+std::map< std::string, Budget > load_budgets(std::string const& filename) {
+	std::map< std::string, Budget > budgets;
+	std::ifstream file(filename);
+	std::string line;
+	while (std::getline(file, line)) {
+		if (line.empty() || line[0] == '#') {
+			continue;
+		}
+		std::istringstream fields(line);
+		std::string name;
+		Budget budget;
+		if (fields >> name >> budget.draw_calls >> budget.vertices >> budget.frame_ms) {
+			budgets[name] = budget;
+		} else {
+			std::cerr << "Ignoring malformed line in '" << filename << "': " << line << std::endl;
+		}
+	}
+	return budgets;
+}
+
+void write_budgets(std::ostream& to, std::vector< Scene > const& list, std::map< std::string, Budget >& budgets) {
+	for (Scene const& scene : list) {
+		Budget const& budget = budgets[scene.name];
+		to << scene.name << " " << budget.draw_calls << " " << budget.vertices << " " << budget.frame_ms << "\n";
+	}
+}
+
+// pixels with a channel more than 'tolerance' away:
+uint32_t count_differences(std::vector< uint32_t > const& a, std::vector< uint32_t > const& b, uint32_t tolerance) {
+	uint32_t count = 0;
+	for (size_t i = 0; i < a.size(); ++i) {
+		for (uint32_t shift = 0; shift < 32; shift += 8) {
+			int32_t d = int32_t(a[i] >> shift & 0xff) - int32_t(b[i] >> shift & 0xff);
+			if (uint32_t(std::abs(d)) > tolerance) {
+				++count;
+				break;
+			}
+		}
+	}
+	return count;
+}
+
+// the scene's buttons, then FRAMES still ticks:
+std::vector< uint8_t > scene_ticks(Scene const& scene) {
+	std::vector< uint8_t > ticks;
+	for (Step const& step : scene.script) {
+		ticks.insert(ticks.end(), step.ticks, step.buttons);
+	}
+	ticks.insert(ticks.end(), FRAMES, 0);
+	return ticks;
+}
+
+// every scene's last frame drawn by SoftwareRenderer, compared with the golden images; returns the failures:
+uint32_t run_software(Config const& config, Level const& level) {
+	uint32_t failures = 0;
+	SoftwareRenderer renderer(config, level, config.size);
+	RegionStreamer streamer(level, "", config.region_budget);
+	for (Scene const& scene : scenes()) {
+		Game game(level, &streamer);
+		game.fit_camera(config.native_size);
+		scene.setup(game);
+		std::vector< uint8_t > ticks = scene_ticks(scene);
+		for (uint8_t buttons : ticks) {
+			game.update(buttons, DT);
+		}
+		auto start = std::chrono::high_resolution_clock::now();
+		renderer.draw(game);
+		float ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		std::vector< uint32_t > pixels = renderer.window.read_pixels();
+
+		std::string image = IMAGES + "/" + scene.name + ".png";
+		std::ostringstream report;
+		bool failed = false;
+		glm::uvec2 size;
+		std::vector< uint32_t > expected;
+		if (!load_png(image, &size.x, &size.y, &expected, LowerLeftOrigin)) {
+			report << "no golden image";
+			failed = true;
+		} else if (size != config.size) {
+			report << "golden image is " << size.x << "x" << size.y;
+			failed = true;
+		} else {
+			uint32_t differ = count_differences(pixels, expected, SOFTWARE_TOLERANCE);
+			report << differ << " pixels differ";
+			failed = differ > SOFTWARE_DIFFERING;
+		}
+		if (failed) {
+			std::string actual = IMAGES + "/" + scene.name + "-software.png";
+			save_png(actual, config.size.x, config.size.y, &pixels[0], LowerLeftOrigin);
+			report << " (wrote " << actual << ")";
+		}
+		failures += failed;
+		std::cout << scene.name << ": " << (failed ? "FAIL" : "ok") << ", " << report.str() << "; drawn in " << ms
+							<< " ms." << std::endl;
+	}
+	return failures;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	bool update = false;
+	bool software = false;
+	bool check_times = false;
+	std::string metrics;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--update") {
+			update = true;
+		} else if (arg == "--software") {
+			software = true;
+		} else if (arg == "--check-times") {
+			check_times = true;
+		} else if (arg == "--metrics" && i + 1 < argc) {
+			metrics = argv[++i];
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--update] [--check-times] [--metrics file] | --software" << std::endl;
+			return 1;
+		}
+	}
+	if (software && (update || check_times || !metrics.empty())) {
+		std::cerr << "--software only checks images; --update, --check-times and --metrics need GL." << std::endl;
+		return 1;
+	}
+
+	Config config;
+	Level level;
+	if (!load_level(config.level, &level)) {
+		std::cerr << "Failed to load level." << std::endl;
+		return 1;
+	}
+
+	if (software) {
+		uint32_t failures = 0;
+		try {
+			failures = run_software(config, level);
+		} catch (std::runtime_error const& error) {
+			std::cerr << error.what() << std::endl;
+			return 1;
+		}
+		if (failures) {
+			std::cout << failures << " of " << scenes().size() << " scenes failed." << std::endl;
+			return 1;
+		}
+		return 0;
+	}
+
+	SDL_Init(SDL_INIT_VIDEO);
+
+	SDL_GL_ResetAttributes();
+	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+	SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+	SDL_Window* window = SDL_CreateWindow("golden", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, config.size.x,
+																				config.size.y, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+	if (!window) {
+		std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+	SDL_GLContext context = SDL_GL_CreateContext(window);
+	if (!context) {
+		SDL_DestroyWindow(window);
+		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+
+#ifdef _WIN32
+	if (!init_gl_shims()) {
+		std::cerr << "ERROR: failed to initialize shims." << std::endl;
+		return 1;
+	}
+#endif
+
+	// frame times should measure the work, not the display:
+	SDL_GL_SetSwapInterval(0);
+
+	glm::uvec2 drawable_size;
+	{
+		int w = 0, h = 0;
+		SDL_GL_GetDrawableSize(window, &w, &h);
+		drawable_size = glm::uvec2(w, h);
+	}
+
+	uint32_t failures = 0;
+	{
+		Renderer renderer(config, window, context, drawable_size);
+		RegionStreamer streamer(level, "assets", config.region_budget);
+		std::vector< Scene > list = scenes();
+		std::map< std::string, Budget > budgets = load_budgets(BUDGETS);
+		std::map< std::string, Budget > measured;
+
+		for (Scene const& scene : list) {
+			Game game(level, &streamer);
+			game.fit_camera(renderer.view_size(drawable_size));
+			scene.setup(game);
+			renderer.invalidate();
+
+			std::vector< uint8_t > ticks = scene_ticks(scene);
+
+			std::vector< float > frame_ms;
+			std::vector< uint32_t > pixels(drawable_size.x * drawable_size.y);
+			for (uint32_t t = 0; t < ticks.size(); ++t) {
+				auto start = std::chrono::high_resolution_clock::now();
+				streamer.update();
+				game.update(ticks[t], DT);
+				renderer.draw(game, drawable_size, DT, start);
+				glFinish();
+				if (t >= ticks.size() - FRAMES + WARMUP) {
+					frame_ms.emplace_back(
+							std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+				}
+				if (t + 1 == ticks.size()) {
+					glReadPixels(0, 0, drawable_size.x, drawable_size.y, GL_RGBA, GL_UNSIGNED_BYTE, &pixels[0]);
+				}
+				SDL_GL_SwapWindow(window);
+			}
+
+			std::sort(frame_ms.begin(), frame_ms.end());
+			Budget& result = measured[scene.name];
+			result.draw_calls = renderer.frame.draw_calls;
+			result.vertices = renderer.frame.vertices;
+			result.frame_ms = frame_ms[frame_ms.size() / 2];
+
+			std::string image = IMAGES + "/" + scene.name + ".png";
+			std::ostringstream report;
+			bool failed = false;
+			if (update) {
+				save_png(image, drawable_size.x, drawable_size.y, &pixels[0], LowerLeftOrigin);
+				report << "updated";
+			} else {
+				glm::uvec2 size;
+				std::vector< uint32_t > expected;
+				if (!load_png(image, &size.x, &size.y, &expected, LowerLeftOrigin)) {
+					report << "no golden image";
+					failed = true;
+				} else if (size != drawable_size) {
+					report << "golden image is " << size.x << "x" << size.y;
+					failed = true;
+				} else {
+					uint32_t differ = count_differences(pixels, expected, TOLERANCE);
+					report << differ << " pixels differ";
+					failed = differ != 0;
+				}
+				if (failed) {
+					std::string actual = IMAGES + "/" + scene.name + "-actual.png";
+					save_png(actual, drawable_size.x, drawable_size.y, &pixels[0], LowerLeftOrigin);
+					report << " (wrote " << actual << ")";
+				}
+
+				auto found = budgets.find(scene.name);
+				if (found == budgets.end()) {
+					report << ", no budget";
+					failed = true;
+				} else {
+					Budget const& budget = found->second;
+					if (result.draw_calls > budget.draw_calls) {
+						report << ", over draw call budget of " << budget.draw_calls;
+						failed = true;
+					}
+					if (result.vertices > budget.vertices) {
+						report << ", over vertex budget of " << budget.vertices;
+						failed = true;
+					}
+					if (check_times && result.frame_ms > budget.frame_ms) {
+						report << ", over frame time budget of " << budget.frame_ms << " ms";
+						failed = true;
+					}
+				}
+			}
+			failures += failed;
+			std::cout << scene.name << ": " << (failed ? "FAIL" : "ok") << ", " << report.str() << "; " << result.draw_calls
+								<< " draw calls, " << result.vertices << " vertices, " << result.frame_ms << " ms median frame."
+								<< std::endl;
+		}
+
+		if (!metrics.empty()) {
+			std::ofstream file(metrics, std::ios::app);
+			write_budgets(file, list, measured);
+		}
+		if (update) {
+			for (auto& entry : measured) {
+				auto found = budgets.find(entry.first);
+				if (found != budgets.end()) {
+					entry.second.frame_ms = found->second.frame_ms;
+				} else {
+					// to the next 0.1 ms:
+					entry.second.frame_ms = std::ceil(entry.second.frame_ms * FRAME_MARGIN * 10.0f) / 10.0f;
+				}
+			}
+			std::ofstream file(BUDGETS);
+			file << BUDGETS_HEADER;
+			write_budgets(file, list, measured);
+		}
+	}
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+
+	if (failures) {
+		std::cout << failures << " of " << scenes().size() << " scenes failed." << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,45 @@
+#include "gpu_timer.hpp"
+
+GpuTimer::GpuTimer() {
+	glGenQueries(RING, &queries[0]);
+}
+
+void GpuTimer::begin() {
+	// with every query still in flight this span goes unmeasured rather than waiting:
+	active = pending < RING;
+	if (active) {
+		glBeginQuery(GL_TIME_ELAPSED, queries[next]);
+	}
+}
+
+void GpuTimer::end() {
+	if (active) {
+		glEndQuery(GL_TIME_ELAPSED);
+		next = (next + 1) % RING;
+		++pending;
+		active = false;
+	}
+}
+
+bool GpuTimer::poll(float* milliseconds) {
+	bool found = false;
+	while (pending) {
+		GLuint query = queries[(next + RING - pending) % RING];
+		GLint available = GL_FALSE;
+		glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available != GL_TRUE) {
+			break;
+		}
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+		--pending;
+		// some drivers (Mesa's llvmpipe, at least) report a timestamp for the very first query:
+		if (!warmed_up) {
+			warmed_up = true;
+			continue;
+		}
+		*milliseconds = float(nanoseconds) * 1e-6f;
+		found = true;
+	}
+	return found;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <array>
+#include <stdint.h>
+
+/*
+ * GPU time of a span of GL commands, measured with GL_TIME_ELAPSED queries. Each
+ * begin()/end() pair uses the next query of a small ring, and poll() reads back only
+ * results the GL reports as available, so timing never stalls the pipeline; results
+ * arrive a frame or more after the commands were issued. GL allows one time elapsed
+ * query to be active at a time, so timers must not nest.
+ */
+
+struct GpuTimer {
+	GpuTimer();
+
+	void begin();
+	void end();
+
+	// reads every finished measurement; returns false if none finished since the last poll,
+	// otherwise sets 'milliseconds' to the most recent:
+	bool poll(float* milliseconds);
+
+	static const uint32_t RING = 4;
+	std::array<GLuint, RING> queries;
+	uint32_t next = 0;    // query the next begin() uses
+	uint32_t pending = 0; // ended but not yet read, oldest at next - pending
+	bool active = false;  // false between begin() and end() if the ring was full
+	bool warmed_up = false; // the first result is dropped (see poll())
+};
@@ -0,0 +1,105 @@
+#include "input_log.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+bool InputLog::save(std::string const& filename) const {
+	std::vector< char > changes;
+	uint32_t count = 0;
+	uint8_t held = 0;
+	uint32_t last = 0;
+	for (uint32_t t = 0; t < buttons.size(); ++t) {
+		if (buttons[t] == held) {
+			continue;
+		}
+		for (uint32_t gap = t - last; true; gap >>= 7) {
+			if (gap < 0x80) {
+				changes.emplace_back(char(gap));
+				break;
+			}
+			changes.emplace_back(char((gap & 0x7f) | 0x80));
+		}
+		changes.emplace_back(char(buttons[t] ^ held));
+		held = buttons[t];
+		last = t;
+		++count;
+	}
+
+	InputLogHeader header;
+	std::memcpy(header.magic, "inp0", 4);
+	header.tick_seconds = tick_seconds;
+	header.ticks = uint32_t(buttons.size());
+	header.changes = count;
+
+	std::ofstream file(filename, std::ios::binary);
+	file.write(reinterpret_cast< char const* >(&header), sizeof(header));
+	file.write(changes.data(), changes.size());
+	file.write(reinterpret_cast< char const* >(hashes.data()), hashes.size() * sizeof(uint32_t));
+	if (!file) {
+		std::cerr << "Failed to write input log '" << filename << "'" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool load_input_log(std::string const& filename, InputLog* log) {
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file) {
+		std::cerr << "Failed to open input log '" << filename << "'" << std::endl;
+		return false;
+	}
+
+	std::vector< char > bytes(size_t(file.tellg()));
+	file.seekg(0);
+	if (bytes.size() < sizeof(InputLogHeader) || !file.read(&bytes[0], bytes.size())) {
+		std::cerr << "Failed to read input log '" << filename << "'" << std::endl;
+		return false;
+	}
+
+	InputLogHeader header;
+	std::memcpy(&header, &bytes[0], sizeof(header));
+	if (std::memcmp(header.magic, "inp0", 4) != 0) {
+		std::cerr << "Input log '" << filename << "' has the wrong magic number" << std::endl;
+		return false;
+	}
+
+	uint8_t const* data = reinterpret_cast< uint8_t const* >(&bytes[0]) + sizeof(header);
+	uint8_t const* end = reinterpret_cast< uint8_t const* >(&bytes[0]) + bytes.size();
+	log->tick_seconds = header.tick_seconds;
+	log->buttons.assign(header.ticks, 0);
+	uint8_t held = 0;
+	uint32_t at = 0;
+	for (uint32_t c = 0; c < header.changes; ++c) {
+		uint32_t gap = 0;
+		for (uint32_t shift = 0; true; shift += 7) {
+			if (data == end || shift > 28) {
+				std::cerr << "Input log '" << filename << "' is truncated" << std::endl;
+				return false;
+			}
+			uint8_t byte = *data++;
+			gap |= uint32_t(byte & 0x7f) << shift;
+			if (!(byte & 0x80)) {
+				break;
+			}
+		}
+		if (data == end || gap > header.ticks - at) {
+			std::cerr << "Input log '" << filename << "' is truncated" << std::endl;
+			return false;
+		}
+		// held until the change:
+		std::fill(log->buttons.begin() + at, log->buttons.begin() + at + gap, held);
+		at += gap;
+		held ^= *data++;
+	}
+	std::fill(log->buttons.begin() + at, log->buttons.end(), held);
+
+	if (size_t(end - data) != header.ticks * sizeof(uint32_t)) {
+		std::cerr << "Input log '" << filename << "' is truncated" << std::endl;
+		return false;
+	}
+	log->hashes.resize(header.ticks);
+	std::memcpy(log->hashes.data(), data, header.ticks * sizeof(uint32_t));
+	return true;
+}
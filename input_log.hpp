@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Per-tick input of a playthrough, for replaying it exactly: the Buttons held on each
+ * tick of a fixed timestep, and a hash of the game state after each tick (Game::hash,
+ * folded to 32 bits) so a replay can report the first tick where it diverges.
+ *
+ * File layout (.inp): an InputLogHeader, then one record per tick on which the buttons
+ * changed: the ticks since the previous change (or since the start) as an unsigned LEB128
+ * varint, then a byte of the button bits that changed. Then one uint32 hash per tick.
+ */
+
+struct InputLogHeader {
+	char magic[4]; // "inp0"
+	float tick_seconds;
+	uint32_t ticks;
+	uint32_t changes; // records before the hashes
+};
+static_assert(sizeof(InputLogHeader) == 16, "InputLogHeader is packed");
+
+struct InputLog {
+	float tick_seconds = 1.0f / 60.0f;
+	// expanded to one entry per tick:
+	std::vector< uint8_t > buttons;
+	std::vector< uint32_t > hashes;
+
+	void record(uint8_t held, uint32_t hash) {
+		buttons.emplace_back(held);
+		hashes.emplace_back(hash);
+	}
+
+	bool save(std::string const& filename) const;
+};
+
+// what a log stores of Game::hash:
+inline uint32_t fold_hash(uint64_t hash) {
+	return uint32_t(hash ^ (hash >> 32));
+}
+
+bool load_input_log(std::string const& filename, InputLog* log);
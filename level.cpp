@@ -0,0 +1,196 @@
+#include "level.hpp"
+#include "sprites.hpp"
+#include "tilemap.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+// copies 'count' records from 'data' into 'out' and advances 'data'; false if the file is too short:
+template< typename T >
+bool read_array(char const *&data, char const *end, uint32_t count, std::vector< T > *out) {
+	if (uint64_t(end - data) < uint64_t(count) * sizeof(T)) {
+		return false;
+	}
+	out->resize(count);
+	if (count) {
+		std::memcpy(&(*out)[0], data, count * sizeof(T));
+	}
+	data += count * sizeof(T);
+	return true;
+}
+
+template< typename T >
+T const *find_named(std::vector< T > const &records, Level const &level, std::string const &name) {
+	for (T const &record : records) {
+		if (name == level.string(record.name)) {
+			return &record;
+		}
+	}
+	return nullptr;
+}
+
+bool check_range(LevelRange const &range, size_t size) {
+	return uint64_t(range.first) + range.count <= size;
+}
+
+} // namespace
+
+ItemDef const *Level::find_item(std::string const &name) const {
+	return find_named(items, *this, name);
+}
+
+PropDef const *Level::find_prop(std::string const &name) const {
+	return find_named(props, *this, name);
+}
+
+VolumeDef const *Level::find_volume(std::string const &name) const {
+	return find_named(volumes, *this, name);
+}
+
+uint32_t region_named(Level const &level, std::string const &name) {
+	for (uint32_t r = 0; r < level.regions.size(); ++r) {
+		if (name == level.string(level.regions[r].name)) {
+			return r;
+		}
+	}
+	throw std::runtime_error("no region named " + name + " in level");
+}
+
+bool load_level(std::string const &filename, Level *level) {
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file) {
+		std::cerr << "Failed to open level '" << filename << "'" << std::endl;
+		return false;
+	}
+
+	std::vector< char > bytes(size_t(file.tellg()));
+	file.seekg(0);
+	if (bytes.size() < sizeof(LevelHeader) || !file.read(&bytes[0], bytes.size())) {
+		std::cerr << "Failed to read level '" << filename << "'" << std::endl;
+		return false;
+	}
+
+	LevelHeader header;
+	std::memcpy(&header, &bytes[0], sizeof(header));
+	if (std::memcmp(header.magic, "lvl0", 4) != 0) {
+		std::cerr << "Level '" << filename << "' has the wrong magic number" << std::endl;
+		return false;
+	}
+
+	char const *data = &bytes[0] + sizeof(header);
+	char const *end = &bytes[0] + bytes.size();
+	if (!read_array(data, end, header.regions, &level->regions) || !read_array(data, end, header.boxes, &level->boxes)
+			|| !read_array(data, end, header.items, &level->items) || !read_array(data, end, header.props, &level->props)
+			|| !read_array(data, end, header.volumes, &level->volumes) || !read_array(data, end, header.hints, &level->hints)
+			|| !read_array(data, end, header.recipes, &level->recipes) || !read_array(data, end, header.tile_layers, &level->tile_layers)
+			|| !read_array(data, end, header.tiles, &level->tiles) || !read_array(data, end, header.strings, &level->strings)) {
+		std::cerr << "Level '" << filename << "' is truncated" << std::endl;
+		return false;
+	}
+
+	// validate indices once here so gameplay can use them unchecked:
+	bool valid = header.start_region < level->regions.size() && !level->strings.empty() && level->strings.back() == '\0';
+	auto check_string = [&](uint32_t offset) { valid = valid && offset < level->strings.size(); };
+	auto check_region = [&](uint32_t region) { valid = valid && region < level->regions.size(); };
+	auto check_sprite = [&](uint32_t sprite) { valid = valid && sprite < SPRITE_COUNT; };
+	// -1 for none, otherwise an index into 'size' records:
+	auto check_link = [&](int32_t index, size_t size) { valid = valid && (index == -1 || (index >= 0 && size_t(index) < size)); };
+
+	for (RegionDef const &region : level->regions) {
+		check_string(region.name);
+		check_string(region.image);
+		if (region.sprite != -1U) {
+			check_sprite(region.sprite);
+		}
+		check_link(region.left, level->regions.size());
+		check_link(region.right, level->regions.size());
+		check_link(region.tile_layer, level->tile_layers.size());
+		valid = valid && check_range(region.boxes, level->boxes.size()) && check_range(region.items, level->items.size())
+				&& check_range(region.props, level->props.size()) && check_range(region.volumes, level->volumes.size())
+				&& check_range(region.hints, level->hints.size());
+	}
+	for (BoxDef const &box : level->boxes) {
+		check_region(box.region);
+		check_string(box.name);
+	}
+	for (ItemDef const &item : level->items) {
+		check_region(item.region);
+		check_string(item.name);
+		check_sprite(item.sprite);
+	}
+	for (PropDef const &prop : level->props) {
+		check_region(prop.region);
+		check_string(prop.name);
+		check_sprite(prop.sprite);
+	}
+	for (VolumeDef const &volume : level->volumes) {
+		check_region(volume.region);
+		check_string(volume.name);
+		check_string(volume.accepts);
+	}
+	for (HintDef const &hint : level->hints) {
+		check_region(hint.region);
+		check_string(hint.text);
+	}
+	for (RecipeDef const &recipe : level->recipes) {
+		check_sprite(recipe.result);
+		check_string(recipe.hint);
+	}
+	for (TileLayerDef const &layer : level->tile_layers) {
+		check_region(layer.region);
+		check_string(layer.tileset);
+		valid = valid && layer.tileset_grid.x && layer.tileset_grid.y
+				&& uint64_t(layer.first_tile) + uint64_t(layer.size.x) * layer.size.y <= level->tiles.size();
+	}
+
+	if (!valid) {
+		std::cerr << "Level '" << filename << "' has out-of-range indices" << std::endl;
+		return false;
+	}
+
+#ifdef COMPACT_VERTICES
+	// world vertices are relative to their region (tiles to their chunk), and must stay within POSITION_LIMIT.
+	// Sprites reach past the player's position by up to REACH (the player's radius, or the item held above it):
+	const float REACH = 2.0f;
+	auto fits = [](glm::vec2 const &extent) {
+		return glm::abs(extent.x) <= POSITION_LIMIT && glm::abs(extent.y) <= POSITION_LIMIT;
+	};
+	for (RegionDef const &region : level->regions) {
+		if (!fits(region.radius + glm::vec2(REACH))) {
+			std::cerr << "Level '" << filename << "' has region '" << level->string(region.name)
+								<< "' wider than compact vertices reach (+/-" << POSITION_LIMIT - REACH << " units)" << std::endl;
+			return false;
+		}
+	}
+	for (ItemDef const &item : level->items) {
+		if (!fits(glm::abs(item.at) + glm::abs(item.radius))) {
+			std::cerr << "Level '" << filename << "' has item '" << level->string(item.name)
+								<< "' past where compact vertices reach (+/-" << POSITION_LIMIT << " units)" << std::endl;
+			return false;
+		}
+	}
+	for (PropDef const &prop : level->props) {
+		if (!fits(glm::abs(prop.at) + glm::abs(prop.radius))) {
+			std::cerr << "Level '" << filename << "' has prop '" << level->string(prop.name)
+								<< "' past where compact vertices reach (+/-" << POSITION_LIMIT << " units)" << std::endl;
+			return false;
+		}
+	}
+	for (TileLayerDef const &layer : level->tile_layers) {
+		if (!fits(glm::vec2(Tilemap::CHUNK_SIZE * layer.tile_size))) {
+			std::cerr << "Level '" << filename << "' has " << layer.tile_size
+								<< " unit tiles, too large for compact vertices to reach across a " << Tilemap::CHUNK_SIZE << " tile chunk"
+								<< std::endl;
+			return false;
+		}
+	}
+#endif
+
+	level->start_region = header.start_region;
+	level->start_at = header.start_at;
+	return true;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Binary level files (.lvl), compiled from the .level text format by asset-watcher.js.
+ *
+ * Layout: a LevelHeader, then the region, box, item, prop, volume, hint, recipe and
+ * tile layer arrays (in that order, sized by the header), then the uint16 tile array,
+ * then a string table of null-terminated strings. Records refer to strings by byte offset; offset 0 is always "".
+ * Every region owns a contiguous [first, first + count) range of each per-region array.
+ */
+
+struct LevelHeader {
+	char magic[4]; // "lvl0"
+	uint32_t start_region;
+	glm::vec2 start_at;
+	uint32_t regions, boxes, items, props, volumes, hints, recipes, tile_layers;
+	uint32_t tiles;
+	uint32_t strings; // bytes
+};
+static_assert(sizeof(LevelHeader) == 56, "LevelHeader is packed");
+
+struct LevelRange {
+	uint32_t first;
+	uint32_t count;
+};
+
+struct RegionDef {
+	uint32_t name;
+	uint32_t sprite; // SpriteInfo of the background, -1U for none
+	uint32_t image; // background image streamed per region (relative to the level), "" to use 'sprite'
+	glm::vec2 radius; // half-extent of the region, centered on 0,0
+	int32_t left, right; // neighbouring regions, -1 for none
+	int32_t tile_layer; // -1 for none
+	LevelRange boxes, items, props, volumes, hints;
+};
+static_assert(sizeof(RegionDef) == 72, "RegionDef is packed");
+
+// collision box (named boxes can be toggled by gameplay):
+struct BoxDef {
+	uint32_t region;
+	uint32_t name;
+	glm::vec2 center;
+	glm::vec2 radius;
+};
+static_assert(sizeof(BoxDef) == 24, "BoxDef is packed");
+
+enum ItemFlags : uint32_t {
+	ITEM_SPAWNED = (1 << 0), // not placed at load; gameplay adds it to its region later
+};
+
+struct ItemDef {
+	uint32_t region;
+	uint32_t name;
+	uint32_t sprite;
+	uint32_t adds; // Workbench bits added when brought to the workbench
+	uint32_t flags;
+	glm::vec2 at;
+	glm::vec2 radius;
+	float reach; // pick-up circle radius around 'at'
+};
+static_assert(sizeof(ItemDef) == 40, "ItemDef is packed");
+
+// static sprite that gameplay shows, hides or swaps by name:
+struct PropDef {
+	uint32_t region;
+	uint32_t name;
+	uint32_t sprite;
+	glm::vec2 at;
+	glm::vec2 radius;
+};
+static_assert(sizeof(PropDef) == 28, "PropDef is packed");
+
+// interaction circle; if 'accepts' names an item, the item can be placed there and is drawn with 'display' radius:
+struct VolumeDef {
+	uint32_t region;
+	uint32_t name;
+	uint32_t accepts;
+	glm::vec2 center;
+	float radius;
+	glm::vec2 display;
+};
+static_assert(sizeof(VolumeDef) == 32, "VolumeDef is packed");
+
+struct HintDef {
+	uint32_t region;
+	uint32_t text;
+	glm::vec2 center;
+	float radius;
+};
+static_assert(sizeof(HintDef) == 20, "HintDef is packed");
+
+struct RecipeDef {
+	uint32_t needs; // Workbench bits
+	uint32_t result; // SpriteInfo of the crafted tool
+	uint32_t hint;
+};
+static_assert(sizeof(RecipeDef) == 12, "RecipeDef is packed");
+
+// tile grid drawn over the region background, see tilemap.hpp:
+struct TileLayerDef {
+	uint32_t region;
+	uint32_t tileset; // image (relative to the level)
+	glm::uvec2 tileset_grid; // tiles across and down the tileset image
+	glm::uvec2 size; // in tiles
+	float tile_size; // world units
+	uint32_t first_tile; // size.x * size.y entries of the tile array, 0xffff for empty
+};
+static_assert(sizeof(TileLayerDef) == 32, "TileLayerDef is packed");
+
+struct Level {
+	uint32_t start_region = 0;
+	glm::vec2 start_at = glm::vec2(0.0f);
+
+	std::vector< RegionDef > regions;
+	std::vector< BoxDef > boxes;
+	std::vector< ItemDef > items;
+	std::vector< PropDef > props;
+	std::vector< VolumeDef > volumes;
+	std::vector< HintDef > hints;
+	std::vector< RecipeDef > recipes;
+	std::vector< TileLayerDef > tile_layers;
+	std::vector< uint16_t > tiles;
+	std::vector< char > strings;
+
+	char const *string(uint32_t offset) const { return &strings[offset]; }
+
+	// first record with the given name, or nullptr:
+	ItemDef const *find_item(std::string const &name) const;
+	PropDef const *find_prop(std::string const &name) const;
+	VolumeDef const *find_volume(std::string const &name) const;
+};
+
+// index of the first region with the given name; throws std::runtime_error if there is none:
+uint32_t region_named(Level const &level, std::string const &name);
+
+// reads the whole file with one read into pre-sized arrays and checks every index in it (sprites against SpriteInfo).
+// COMPACT_VERTICES builds also check that regions, items, props and tile chunks fit the int16 positions (POSITION_LIMIT).
+// Prints a message and returns false on failure:
+bool load_level(std::string const &filename, Level *level);
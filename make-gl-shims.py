@@ -1,11 +1,16 @@
 #!/usr/bin/env python3
 
 #create gl_shims.hpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
+#with 'dispatch' as an argument, instead create gl_dispatch.hpp: wrappers of the same functions for gl_stats.cpp (see gl_stats.hpp).
+#  python3 make-gl-shims.py > gl_shims.hpp
+#  python3 make-gl-shims.py dispatch > gl_dispatch.hpp
 
 import re
+import sys
 
 protos = []
 extensions = []
+functions = [] #(return type, name without 'gl', parameter list) of everything through 3_3
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -20,7 +25,7 @@ with open('glcorearb.h', 'r') as f:
 				protos.append("\n// " + in_version + " prototypes:\n")
 				do_proto = True
 				do_extension = False
-			elif (major,minor) < (3,3):
+			elif (major,minor) <= (3,3):
 				extensions.append("\n// " + in_version + " extensions:\n")
 				do_proto = False
 				do_extension = True
@@ -28,6 +33,10 @@ with open('glcorearb.h', 'r') as f:
 				do_proto = False
 				do_extension = False
 		if in_version:
+			if (major,minor) <= (3,3):
+				m = re.match(r"^GLAPI (.+?) ?APIENTRY gl(\w+) \((.*)\);$", line)
+				if m != None:
+					functions.append((m.group(1), m.group(2), m.group(3)))
 			if do_proto:
 				m = re.match(r"^GLAPI ", line)
 				if m != None:
@@ -45,6 +54,41 @@ with open('glcorearb.h', 'r') as f:
 			if m != None:
 				in_version = None
 
+def argument_names(params):
+	if params == "void":
+		return ""
+	return ", ".join(re.search(r"(\w+)$", param.strip()).group(1) for param in params.split(","))
+
+if sys.argv[1:] == ["dispatch"]:
+	print("""//generated by make-gl-shims.py; see gl_stats.hpp
+
+//Included through GL.hpp, this redirects every gl* call to a counting wrapper.
+//gl_stats.cpp includes it with GL_DISPATCH defined to get one entry per wrapper instead:
+//  GL_DISPATCH(return type, name without 'gl', (parameters), (arguments))
+
+#ifndef GL_DISPATCH
+
+#ifndef GL_DISPATCH_HPP
+#define GL_DISPATCH_HPP 1
+
+extern "C" {
+""")
+	for (ret, name, params) in functions:
+		print("GLAPI " + ret + " APIENTRY gl_stats_" + name + " (" + params + ");")
+		print("#define gl" + name + " gl_stats_" + name)
+	print("""
+}
+
+#endif //GL_DISPATCH_HPP
+
+#else
+""")
+	for (ret, name, params) in functions:
+		print("GL_DISPATCH(" + ret + ", " + name + ", (" + params + "), (" + argument_names(params) + "))")
+	print("""
+#endif //GL_DISPATCH""")
+	sys.exit(0)
+
 print("""#ifndef GL_SHIMS_HPP
 #define GL_SHIMS_HPP 1
 
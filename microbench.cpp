@@ -0,0 +1,295 @@
+#include "sprite_batch.hpp"
+#include "draw_list.hpp"
+#include "quad_kernel.hpp"
+#include "sprites.hpp"
+#include "geometry.hpp"
+#include "load_save_png.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * Micro-benchmarks of CPU hot paths, without a window or GL context. Each case runs its
+ * operation in batches until a batch takes at least BATCH_SECONDS, then times SAMPLES
+ * batches of that size and reports the median: ns per operation, operations (and bytes,
+ * where it means something) per second, and heap allocations per operation, counted by
+ * replacing the global operator new.
+ * Run from the repository root: dist/microbench [--json file] [name filter]
+ *  --json writes the results to 'file' as well, as an array of objects, for tracking over time.
+ */
+
+namespace {
+
+std::atomic< uint64_t > allocations(0);
+
+const double BATCH_SECONDS = 0.02;
+const uint32_t SAMPLES = 9;
+
+struct Result {
+	std::string name;
+	double ns_per_op = 0.0;
+	double ops_per_second = 0.0;
+	double bytes_per_second = 0.0; // 0 where ops aren't about bytes
+	double allocations_per_op = 0.0;
+};
+
+// times 'op' (which does 'ops' operations on 'bytes' bytes per call):
+Result run(std::string const& name, uint64_t ops, uint64_t bytes, std::function< void() > const& op) {
+	typedef std::chrono::high_resolution_clock Clock;
+	auto seconds = [](Clock::time_point start) { return std::chrono::duration<double>(Clock::now() - start).count(); };
+
+	// warm up and size the batch:
+	uint64_t calls = 1;
+	while (true) {
+		auto start = Clock::now();
+		for (uint64_t i = 0; i < calls; ++i) {
+			op();
+		}
+		if (seconds(start) >= BATCH_SECONDS) {
+			break;
+		}
+		calls *= 2;
+	}
+
+	std::vector< double > samples;
+	samples.reserve(SAMPLES); // so only 'op' allocates while counting
+	uint64_t allocated = 0;
+	for (uint32_t s = 0; s < SAMPLES; ++s) {
+		uint64_t before = allocations;
+		auto start = Clock::now();
+		for (uint64_t i = 0; i < calls; ++i) {
+			op();
+		}
+		samples.emplace_back(seconds(start));
+		allocated += allocations - before;
+	}
+	std::sort(samples.begin(), samples.end());
+	double median = samples[SAMPLES / 2];
+
+	Result result;
+	result.name = name;
+	result.ns_per_op = median / (calls * ops) * 1e9;
+	result.ops_per_second = calls * ops / median;
+	result.bytes_per_second = bytes ? calls * bytes / median : 0.0;
+	result.allocations_per_op = double(allocated) / (double(SAMPLES) * calls * ops);
+	return result;
+}
+
+void print(Result const& result) {
+	std::cout << result.name << ": " << result.ns_per_op << " ns/op, " << result.ops_per_second << " ops/s, ";
+	if (result.bytes_per_second) {
+		std::cout << result.bytes_per_second / (1024.0 * 1024.0) << " MiB/s, ";
+	}
+	std::cout << result.allocations_per_op << " allocations/op" << std::endl;
+}
+
+void write_json(std::ostream& to, std::vector< Result > const& results) {
+	to << "[\n";
+	for (size_t i = 0; i < results.size(); ++i) {
+		Result const& r = results[i];
+		to << "\t{\"name\": \"" << r.name << "\", \"ns_per_op\": " << r.ns_per_op << ", \"ops_per_second\": "
+			 << r.ops_per_second << ", \"bytes_per_second\": " << r.bytes_per_second << ", \"allocations_per_op\": "
+			 << r.allocations_per_op << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	to << "]\n";
+}
+
+size_t file_size(std::string const& filename) {
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	return file ? size_t(file.tellg()) : 0;
+}
+
+const uint32_t SPRITES = 1000; // per draw_sprite op batch
+const uint32_t KERNEL_SPRITES = 1000000; // per op of the large vertex kernel cases, far past the caches
+const uint32_t SHAPES = 1024;  // boxes and circles tested per contains op batch
+
+} // namespace
+
+void* operator new(std::size_t size) {
+	++allocations;
+	if (void* p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+int main(int argc, char** argv) {
+	std::string json;
+	std::string filter;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--json" && i + 1 < argc) {
+			json = argv[++i];
+		} else if (!arg.empty() && arg[0] != '-') {
+			filter = arg;
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--json file] [name filter]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector< std::string > pages = {"assets/stuff", "assets/glyphs"};
+	for (uint32_t p = 0; p < pages.size(); ++p) {
+		if (!load_sprite_info(pages[p] + ".file", p)) {
+			return 1;
+		}
+	}
+
+	std::vector< Result > results;
+	auto bench = [&](std::string const& name, uint64_t ops, uint64_t bytes, std::function< void() > const& op) {
+		if (name.find(filter) == std::string::npos) {
+			return;
+		}
+		results.emplace_back(run(name, ops, bytes, op));
+		print(results.back());
+	};
+
+	// vertex generation, into a batch that already has room, as in a steady frame:
+	VertexAttributes attributes;
+	SpriteBatch batch(attributes, GL_STREAM_DRAW);
+	batch.verts.reserve(SPRITES * 4 * 32);
+	SpriteData sprite = load_sprite(PLAYER);
+	std::vector< glm::vec2 > at(SPRITES);
+	for (uint32_t i = 0; i < SPRITES; ++i) {
+		at[i] = glm::vec2(float(i % 32) - 16.0f, float(i / 32 % 24) - 12.0f);
+	}
+	for (float angle : {0.0f, 0.3f}) {
+		bench(angle == 0.0f ? "draw_sprite" : "draw_sprite (rotated)", SPRITES, 0, [&]() {
+			batch.clear();
+			for (uint32_t i = 0; i < SPRITES; ++i) {
+				batch.draw_sprite(sprite, glm::vec2(0.5f, 1.0f), at[i], glm::u8vec4(0xff), angle);
+			}
+		});
+	}
+
+	// the path world sprites take each frame: submit, then cull, sort and write_quads in emit(). Sprites alternate
+	// between two layers and two textures and are spread over twice the view, so about half are culled:
+	DrawList list;
+	std::vector< glm::vec2 > spread(SPRITES);
+	for (uint32_t i = 0; i < SPRITES; ++i) {
+		spread[i] = at[i] * 2.0f;
+	}
+	bench("DrawList submit+emit", SPRITES, 0, [&]() {
+		list.clear();
+		for (uint32_t i = 0; i < SPRITES; ++i) {
+			list.submit(sprite, glm::vec2(0.5f, 1.0f), spread[i], uint8_t(i % 2), GLuint(1 + i / 2 % 2));
+		}
+		batch.clear();
+		list.emit(glm::vec2(-16.0f, -12.0f), glm::vec2(16.0f, 12.0f), &batch);
+	});
+	std::vector< Vertex > verts(SPRITES * 4);
+	for (float angle : {0.0f, 0.3f}) {
+		QuadArrays quads;
+		for (uint32_t i = 0; i < SPRITES; ++i) {
+			quads.push_back(sprite, glm::vec2(0.5f, 1.0f), at[i], glm::u8vec4(0xff), angle);
+		}
+		bench(angle == 0.0f ? "write_quads" : "write_quads (rotated)", SPRITES, 0, [&]() {
+			write_quads(quads, &verts[0]);
+		});
+	}
+
+	// the same comparison over a million tiny sprites, so vertex writes go out to memory (scoped, to free them after):
+	{
+		SpriteBatch large(attributes, GL_STREAM_DRAW);
+		large.verts.reserve(KERNEL_SPRITES * 4);
+		auto sprite_at = [](uint32_t i) { return glm::vec2(float(i % 200) - 100.0f, float(i / 200 % 200) - 100.0f); };
+		for (float angle : {0.0f, 0.3f}) {
+			std::string suffix = angle == 0.0f ? " (1M sprites)" : " (1M sprites, rotated)";
+			bench("draw_sprite" + suffix, KERNEL_SPRITES, KERNEL_SPRITES * 4 * sizeof(Vertex), [&]() {
+				large.clear();
+				for (uint32_t i = 0; i < KERNEL_SPRITES; ++i) {
+					large.draw_sprite(sprite, glm::vec2(0.5f, 0.5f), sprite_at(i), glm::u8vec4(0xff), angle);
+				}
+			});
+			QuadArrays quads;
+			quads.reserve(KERNEL_SPRITES);
+			for (uint32_t i = 0; i < KERNEL_SPRITES; ++i) {
+				quads.push_back(sprite, glm::vec2(0.5f, 0.5f), sprite_at(i), glm::u8vec4(0xff), angle);
+			}
+			large.verts.resize(KERNEL_SPRITES * 4);
+			bench("write_quads" + suffix, KERNEL_SPRITES, KERNEL_SPRITES * 4 * sizeof(Vertex), [&]() {
+				write_quads(quads, &large.verts[0]);
+			});
+		}
+	}
+
+	std::string word = "FIND SOMETHING MEANINGFUL";
+	bench("draw_word (" + std::to_string(word.size()) + " characters)", 1, 0, [&]() {
+		batch.clear();
+		batch.draw_word(word, glm::vec2(-15.0f, -11.0f));
+	});
+
+	// the collision and interaction tests of a tick, over more shapes than a region has:
+	std::vector< BoundingBox > boxes(SHAPES);
+	std::vector< Circle > circles(SHAPES);
+	for (uint32_t i = 0; i < SHAPES; ++i) {
+		glm::vec2 center(float(i * 37 % 64) * 0.5f - 16.0f, float(i * 53 % 48) * 0.5f - 12.0f);
+		boxes[i].set(center, glm::vec2(0.5f + float(i % 4) * 0.25f, 0.5f));
+		circles[i] = Circle(center, 0.75f);
+	}
+	BoundingBox player(glm::vec2(0.3f, -0.2f), glm::vec2(0.5f, 1.0f));
+	volatile uint32_t hits = 0; // keeps the loops from being optimized away
+	bench("BoundingBox::contains", SHAPES, 0, [&]() {
+		uint32_t count = 0;
+		for (BoundingBox const& box : boxes) {
+			count += box.contains(player);
+		}
+		hits = count;
+	});
+	bench("Circle::contains", SHAPES, 0, [&]() {
+		uint32_t count = 0;
+		for (Circle const& circle : circles) {
+			count += circle.contains(player.center);
+		}
+		hits = count;
+	});
+
+	// asset loading, from the page cache after the first run:
+	std::string info = pages[0] + ".file";
+	bench("load_sprite_info (" + info + ")", 1, file_size(info), [&]() {
+		sprites.clear();
+		load_sprite_info(info, 0);
+	});
+
+	std::string image = "assets/map_middle.png";
+	glm::uvec2 size;
+	std::vector< uint32_t > pixels;
+	if (!load_png(image, &size.x, &size.y, &pixels, LowerLeftOrigin)) {
+		std::cerr << "Failed to load '" << image << "'" << std::endl;
+		return 1;
+	}
+	// decoded bytes, so load and save rates compare:
+	size_t decoded = pixels.size() * sizeof(uint32_t);
+	bench("load_png (" + image + ")", 1, decoded, [&]() {
+		std::vector< uint32_t > data;
+		load_png(image, &size.x, &size.y, &data, LowerLeftOrigin);
+	});
+	bench("save_png (" + image + ", to memory)", 1, decoded, [&]() {
+		std::ostringstream out;
+		save_png(out, size.x, size.y, &pixels[0], LowerLeftOrigin);
+	});
+
+	if (!json.empty()) {
+		std::ofstream file(json);
+		write_json(file, results);
+		if (!file) {
+			std::cerr << "Failed to write '" << json << "'" << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}
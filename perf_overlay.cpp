@@ -0,0 +1,78 @@
+#include "perf_overlay.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+const float GLYPH = 0.5f;        // glyph advance; glyphs are 1.2 times as tall
+const float LINE = 0.75f;        // line spacing
+const float PAD = 0.25f;         // panel margin
+const float BAR = 0.125f;        // graph bar width
+const float GRAPH_HEIGHT = 3.0f; // at GRAPH_MS
+const float GRAPH_MS = 50.0f;
+const float BUDGET_MS = 1000.0f / 60.0f;
+
+const glm::u8vec4 PANEL = glm::u8vec4(0x00, 0x00, 0x00, 0xc0);
+const glm::u8vec4 WITHIN_BUDGET = glm::u8vec4(0x40, 0xe0, 0x40, 0xff);
+const glm::u8vec4 OVER_BUDGET = glm::u8vec4(0xf0, 0x40, 0x30, 0xff);
+const glm::u8vec4 BUDGET_LINE = glm::u8vec4(0xff, 0xff, 0xff, 0x80);
+const uint32_t LINES = 5; // of text, above the graph
+
+} // namespace
+
+PerfOverlay::PerfOverlay(VertexAttributes const& attributes) : batch(attributes, GL_STREAM_DRAW) {
+	frame_ms.fill(0.0f);
+}
+
+void PerfOverlay::record(FrameStats const& frame) {
+	latest = frame;
+	frame_ms[next] = frame.frame_ms;
+	next = (next + 1) % HISTORY;
+}
+
+void PerfOverlay::draw(glm::vec2 const& corner) {
+	char lines[LINES][64];
+	std::snprintf(lines[0], sizeof(lines[0]), "FRAME %.1f MS, CPU %.1f MS", latest.frame_ms, latest.cpu_ms);
+	std::snprintf(lines[1], sizeof(lines[1]), "GPU %.2f MS: CLEAR %.2f, WORLD %.2f,",
+								latest.gpu_clear_ms + latest.gpu_world_ms + latest.gpu_present_ms + latest.gpu_interface_ms,
+								latest.gpu_clear_ms, latest.gpu_world_ms);
+	std::snprintf(lines[2], sizeof(lines[2]), "PRESENT %.2f, INTERFACE %.2f", latest.gpu_present_ms,
+								latest.gpu_interface_ms);
+	std::snprintf(lines[3], sizeof(lines[3]), "%u DRAW CALLS, %u VERTICES", latest.draw_calls, latest.vertices);
+	std::snprintf(lines[4], sizeof(lines[4]), "%u SPRITES, %u CULLED", latest.sprites_drawn, latest.sprites_culled);
+
+	size_t longest = 0;
+	for (auto const& line : lines) {
+		longest = std::max(longest, std::string(line).size());
+	}
+	glm::vec2 size = glm::vec2(std::max(longest * GLYPH, HISTORY * BAR), LINES * LINE + GRAPH_HEIGHT + PAD) + 2.0f * PAD;
+
+	SpriteData solid = load_sprite(SOLID);
+	batch.clear();
+	batch.draw_sprite(solid, 0.5f * size, corner + glm::vec2(0.5f, -0.5f) * size, PANEL);
+
+	glm::vec2 rad = glm::vec2(0.5f, 0.6f) * GLYPH;
+	for (uint32_t l = 0; l < LINES; ++l) {
+		glm::vec2 at = corner + glm::vec2(PAD + 0.5f * GLYPH, -PAD - (float(l) + 0.5f) * LINE);
+		for (char const* c = lines[l]; *c; ++c, at.x += GLYPH) {
+			batch.draw_sprite(glyph_sprite(*c), rad, at);
+		}
+	}
+
+	// oldest frame on the left:
+	glm::vec2 base = corner + glm::vec2(PAD, -size.y + PAD);
+	for (uint32_t i = 0; i < HISTORY; ++i) {
+		float ms = frame_ms[(next + i) % HISTORY];
+		float height = std::min(ms / GRAPH_MS, 1.0f) * GRAPH_HEIGHT;
+		batch.draw_sprite(solid, glm::vec2(0.5f * BAR, 0.5f * height), base + glm::vec2((float(i) + 0.5f) * BAR, 0.5f * height),
+											ms > BUDGET_MS ? OVER_BUDGET : WITHIN_BUDGET);
+	}
+	float budget = BUDGET_MS / GRAPH_MS * GRAPH_HEIGHT;
+	batch.draw_sprite(solid, glm::vec2(0.5f * HISTORY * BAR, 0.03f), base + glm::vec2(0.5f * HISTORY * BAR, budget),
+										BUDGET_LINE);
+
+	batch.upload();
+	batch.draw();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "sprite_batch.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <stdint.h>
+
+/*
+ * A panel of frame timings drawn with the sprite program and atlas: CPU and GPU times
+ * (GPU times are a few frames old, see GpuTimer), draw calls, vertices, sprites drawn
+ * and culled, and a graph of recent frame times against the 60Hz budget. Frames are
+ * recorded whether or not the panel is shown, so the graph is already full when it is
+ * toggled on.
+ */
+
+struct FrameStats {
+	float frame_ms = 0.0f; // wall clock, frame start to frame start
+	float cpu_ms = 0.0f;   // update and draw submission, not counting the wait in swap
+	float gpu_clear_ms = 0.0f;
+	float gpu_world_ms = 0.0f;
+	float gpu_present_ms = 0.0f;
+	float gpu_interface_ms = 0.0f;
+	uint32_t draw_calls = 0;
+	uint32_t vertices = 0;
+	uint32_t sprites_drawn = 0; // world sprites that survived culling, static and streamed
+	uint32_t sprites_culled = 0;
+};
+
+struct PerfOverlay {
+	PerfOverlay(VertexAttributes const& attributes);
+
+	void record(FrameStats const& frame);
+
+	// lay out the panel with its top left corner at 'corner' (in screen units, where glyphs
+	// are 1 unit apart) and draw it with the bound sprite program and atlas:
+	void draw(glm::vec2 const& corner);
+
+	bool visible = false;
+
+	static const uint32_t HISTORY = 120; // frames in the graph
+
+private:
+	SpriteBatch batch;
+	FrameStats latest;
+	std::array<float, HISTORY> frame_ms;
+	uint32_t next = 0; // oldest entry of 'frame_ms', overwritten by the next record()
+};
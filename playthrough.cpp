@@ -0,0 +1,278 @@
+#include "config.hpp"
+#include "level.hpp"
+#include "region_streamer.hpp"
+#include "game.hpp"
+#include "bot.hpp"
+#include "renderer.hpp"
+#include "input_log.hpp"
+#include "GL.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * End-to-end throughput benchmark: a Bot plays the whole puzzle from the start to the
+ * win, many times over, and each phase of the playthrough (see Bot::phase) reports its
+ * ticks per run, ticks per second and the distribution of its frame times. Headless,
+ * a frame is one Game::update, with collision boxes streamed but no GL. Rendered, it is
+ * also drawn into a hidden window and waited for with glFinish, as golden.cpp does.
+ * Every run must win in the same number of ticks, ending in the same Game::hash.
+ * Run from the repository root: dist/playthrough [--render] [--runs N] [--json file]
+ *  --runs defaults to RUNS headless and RENDERED_RUNS rendered.
+ *  --json writes the results to 'file' as well, as an array of objects, one per phase and one for the total.
+ */
+
+namespace {
+
+const float DT = 1.0f / 60.0f;
+const uint32_t RUNS = 1000;
+const uint32_t RENDERED_RUNS = 10;
+const uint32_t MAX_TICKS = 60 * 60 * 10; // per run, in case the bot is walking in circles
+
+struct Phase {
+	std::string name;
+	uint64_t ticks = 0;
+	double seconds = 0.0;
+	std::vector< float > frame_us;
+};
+
+struct Result {
+	std::string phase;
+	double ticks_per_run = 0.0;
+	double ticks_per_second = 0.0;
+	float p50_us = 0.0f, p90_us = 0.0f, p99_us = 0.0f, max_us = 0.0f;
+};
+
+Result summarize(Phase& phase, uint32_t runs) {
+	Result result;
+	result.phase = phase.name;
+	result.ticks_per_run = double(phase.ticks) / runs;
+	result.ticks_per_second = phase.ticks / phase.seconds;
+	std::vector< float >& us = phase.frame_us;
+	std::sort(us.begin(), us.end());
+	auto percentile = [&us](double p) { return us[std::min(us.size() - 1, size_t(p * us.size()))]; };
+	result.p50_us = percentile(0.5);
+	result.p90_us = percentile(0.9);
+	result.p99_us = percentile(0.99);
+	result.max_us = us.back();
+	return result;
+}
+
+void print(Result const& result) {
+	std::cout << result.phase << ": " << result.ticks_per_run << " ticks/run, " << result.ticks_per_second
+						<< " ticks/s, frame p50 " << result.p50_us << " us, p90 " << result.p90_us << " us, p99 " << result.p99_us
+						<< " us, max " << result.max_us << " us" << std::endl;
+}
+
+void write_json(std::ostream& to, std::vector< Result > const& results) {
+	to << "[\n";
+	for (size_t i = 0; i < results.size(); ++i) {
+		Result const& r = results[i];
+		to << "\t{\"phase\": \"" << r.phase << "\", \"ticks_per_run\": " << r.ticks_per_run << ", \"ticks_per_second\": "
+			 << r.ticks_per_second << ", \"p50_us\": " << r.p50_us << ", \"p90_us\": " << r.p90_us << ", \"p99_us\": "
+			 << r.p99_us << ", \"max_us\": " << r.max_us << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+	}
+	to << "]\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	bool render = false;
+	uint32_t runs = 0;
+	std::string json;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--render") {
+			render = true;
+		} else if (arg == "--runs" && i + 1 < argc) {
+			runs = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--json" && i + 1 < argc) {
+			json = argv[++i];
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--render] [--runs N] [--json file]" << std::endl;
+			return 1;
+		}
+	}
+	if (runs == 0) {
+		runs = render ? RENDERED_RUNS : RUNS;
+	}
+
+	Config config;
+	Level level;
+	if (!load_level(config.level, &level)) {
+		std::cerr << "Failed to load level." << std::endl;
+		return 1;
+	}
+
+	SDL_Window* window = nullptr;
+	SDL_GLContext context = 0;
+	glm::uvec2 drawable_size(0, 0);
+	if (render) {
+		SDL_Init(SDL_INIT_VIDEO);
+
+		SDL_GL_ResetAttributes();
+		SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_BLUE_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_ALPHA_SIZE, 8);
+		SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+
+		window = SDL_CreateWindow("playthrough", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, config.size.x,
+															config.size.y, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+		if (!window) {
+			std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+			return 1;
+		}
+		context = SDL_GL_CreateContext(window);
+		if (!context) {
+			SDL_DestroyWindow(window);
+			std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+			return 1;
+		}
+
+#ifdef _WIN32
+		if (!init_gl_shims()) {
+			std::cerr << "ERROR: failed to initialize shims." << std::endl;
+			return 1;
+		}
+#endif
+
+		// frame times should measure the work, not the display:
+		SDL_GL_SetSwapInterval(0);
+
+		int w = 0, h = 0;
+		SDL_GL_GetDrawableSize(window, &w, &h);
+		drawable_size = glm::uvec2(w, h);
+	} else {
+		// the renderer's atlas would load these; Game needs them for its sprites:
+		for (uint32_t p = 0; p < config.atlas_pages.size(); ++p) {
+			if (!load_sprite_info(config.atlas_pages[p] + ".file", p)) {
+				return 1;
+			}
+		}
+	}
+
+	int status = 0;
+	{
+		std::unique_ptr< Renderer > renderer;
+		if (render) {
+			renderer.reset(new Renderer(config, window, context, drawable_size));
+		}
+		// headless, only collision boxes are loaded:
+		RegionStreamer streamer(level, render ? "assets" : "", config.region_budget);
+
+		std::vector< Phase > phases;
+		std::map< std::string, uint32_t > phase_index;
+		uint32_t run_ticks = 0;
+		uint32_t run_hash = 0;
+		try {
+			for (uint32_t run = 0; run < runs; ++run) {
+				Game game(level, &streamer);
+				if (renderer) {
+					game.fit_camera(renderer->view_size(drawable_size));
+					renderer->invalidate();
+				}
+				Bot bot(game, DT);
+
+				uint32_t ticks = 0;
+				std::string const* name = nullptr;
+				Phase* phase = nullptr;
+				while (!bot.finished()) {
+					if (name != &bot.phase()) {
+						name = &bot.phase();
+						auto found = phase_index.find(*name);
+						if (found == phase_index.end()) {
+							found = phase_index.insert(std::make_pair(*name, uint32_t(phases.size()))).first;
+							phases.emplace_back();
+							phases.back().name = *name;
+						}
+						phase = &phases[found->second];
+					}
+					uint8_t buttons = bot.buttons();
+
+					auto start = std::chrono::high_resolution_clock::now();
+					if (renderer) {
+						streamer.update();
+					}
+					game.update(buttons, DT);
+					if (renderer) {
+						renderer->draw(game, drawable_size, DT, start);
+						glFinish();
+					}
+					float us = std::chrono::duration< float, std::micro >(std::chrono::high_resolution_clock::now() - start).count();
+					if (renderer) {
+						SDL_GL_SwapWindow(window);
+					}
+
+					phase->frame_us.emplace_back(us);
+					phase->seconds += us * 1e-6;
+					++phase->ticks;
+					if (++ticks > MAX_TICKS) {
+						throw std::runtime_error("bot didn't finish in " + std::to_string(MAX_TICKS) + " ticks");
+					}
+				}
+
+				uint32_t hash = fold_hash(game.hash());
+				if (!game.won()) {
+					throw std::runtime_error("bot finished without winning");
+				}
+				if (run == 0) {
+					run_ticks = ticks;
+					run_hash = hash;
+				} else if (ticks != run_ticks || hash != run_hash) {
+					throw std::runtime_error("run " + std::to_string(run) + " played out differently from the first");
+				}
+			}
+		} catch (std::runtime_error const& error) {
+			std::cerr << "Playthrough failed: " << error.what() << std::endl;
+			status = 1;
+		}
+
+		if (status == 0) {
+			std::cout << "Won " << runs << " runs of " << run_ticks << " ticks " << (render ? "rendered" : "headless")
+								<< ", each ending in state " << std::hex << run_hash << std::dec << "." << std::endl;
+			std::vector< Result > results;
+			Phase total;
+			total.name = "total";
+			for (Phase& phase : phases) {
+				total.ticks += phase.ticks;
+				total.seconds += phase.seconds;
+				total.frame_us.insert(total.frame_us.end(), phase.frame_us.begin(), phase.frame_us.end());
+				results.emplace_back(summarize(phase, runs));
+				print(results.back());
+			}
+			results.emplace_back(summarize(total, runs));
+			print(results.back());
+
+			if (!json.empty()) {
+				std::ofstream file(json);
+				write_json(file, results);
+				if (!file) {
+					std::cerr << "Failed to write '" << json << "'" << std::endl;
+					status = 1;
+				}
+			}
+		}
+	}
+
+	if (render) {
+		SDL_GL_DeleteContext(context);
+		SDL_DestroyWindow(window);
+	}
+	return status;
+}
@@ -0,0 +1,288 @@
+#include "quad_kernel.hpp"
+
+#include <cassert>
+#include <cmath>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+void QuadArrays::clear() {
+	at_x.clear();
+	at_y.clear();
+	rad_x.clear();
+	rad_y.clear();
+	angle.clear();
+	min_u.clear();
+	min_v.clear();
+	max_u.clear();
+	max_v.clear();
+	layer.clear();
+	tint.clear();
+}
+
+void QuadArrays::reserve(size_t count) {
+	at_x.reserve(count);
+	at_y.reserve(count);
+	rad_x.reserve(count);
+	rad_y.reserve(count);
+	angle.reserve(count);
+	min_u.reserve(count);
+	min_v.reserve(count);
+	max_u.reserve(count);
+	max_v.reserve(count);
+	layer.reserve(count);
+	tint.reserve(count);
+}
+
+void QuadArrays::push_back(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at, glm::u8vec4 tint_,
+													 float angle_) {
+	at_x.emplace_back(at.x);
+	at_y.emplace_back(at.y);
+	rad_x.emplace_back(rad.x);
+	rad_y.emplace_back(rad.y);
+	angle.emplace_back(angle_);
+	min_u.emplace_back(sprite.min_uv.x);
+	min_v.emplace_back(sprite.min_uv.y);
+	max_u.emplace_back(sprite.max_uv.x);
+	max_v.emplace_back(sprite.max_uv.y);
+	layer.emplace_back(float(sprite.layer));
+	tint.emplace_back(tint_);
+}
+
+void QuadArrays::push_back(QuadArrays const& other, size_t i) {
+	at_x.emplace_back(other.at_x[i]);
+	at_y.emplace_back(other.at_y[i]);
+	rad_x.emplace_back(other.rad_x[i]);
+	rad_y.emplace_back(other.rad_y[i]);
+	angle.emplace_back(other.angle[i]);
+	min_u.emplace_back(other.min_u[i]);
+	min_v.emplace_back(other.min_v[i]);
+	max_u.emplace_back(other.max_u[i]);
+	max_v.emplace_back(other.max_v[i]);
+	layer.emplace_back(other.layer[i]);
+	tint.emplace_back(other.tint[i]);
+}
+
+namespace {
+
+// the few vector operations the kernel needs, for each instruction set:
+#if defined(__AVX2__)
+struct Lanes {
+	static const size_t WIDTH = 8;
+	__m256 v;
+	Lanes(__m256 v_) : v(v_) {}
+	static Lanes load(float const* p) { return _mm256_loadu_ps(p); }
+	static Lanes splat(float f) { return _mm256_set1_ps(f); }
+	void store(float* p) const { _mm256_storeu_ps(p, v); }
+	Lanes operator+(Lanes const& o) const { return _mm256_add_ps(v, o.v); }
+	Lanes operator-(Lanes const& o) const { return _mm256_sub_ps(v, o.v); }
+	Lanes operator*(Lanes const& o) const { return _mm256_mul_ps(v, o.v); }
+	bool any_nonzero() const { return _mm256_movemask_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_NEQ_UQ)) != 0; }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+struct Lanes {
+	static const size_t WIDTH = 4;
+	__m128 v;
+	Lanes(__m128 v_) : v(v_) {}
+	static Lanes load(float const* p) { return _mm_loadu_ps(p); }
+	static Lanes splat(float f) { return _mm_set1_ps(f); }
+	void store(float* p) const { _mm_storeu_ps(p, v); }
+	Lanes operator+(Lanes const& o) const { return _mm_add_ps(v, o.v); }
+	Lanes operator-(Lanes const& o) const { return _mm_sub_ps(v, o.v); }
+	Lanes operator*(Lanes const& o) const { return _mm_mul_ps(v, o.v); }
+	bool any_nonzero() const { return _mm_movemask_ps(_mm_cmpneq_ps(v, _mm_setzero_ps())) != 0; }
+};
+#else
+struct Lanes {
+	static const size_t WIDTH = 1;
+	float v;
+	Lanes(float v_) : v(v_) {}
+	static Lanes load(float const* p) { return *p; }
+	static Lanes splat(float f) { return f; }
+	void store(float* p) const { *p = v; }
+	Lanes operator+(Lanes const& o) const { return v + o.v; }
+	Lanes operator-(Lanes const& o) const { return v - o.v; }
+	Lanes operator*(Lanes const& o) const { return v * o.v; }
+	bool any_nonzero() const { return v != 0.0f; }
+};
+#endif
+
+const size_t LANES = Lanes::WIDTH;
+
+// corners of quads [i, i + LANES), as in draw_sprite: at + right * (+/-rad.x) + up * (+/-rad.y)
+// with right = (c, s), up = (-s, c). Returns x then y for (-,-), (-,+), (+,-), (+,+):
+void corners(QuadArrays const& q, size_t i, float out[8][LANES]) {
+	Lanes ax = Lanes::load(&q.at_x[i]);
+	Lanes ay = Lanes::load(&q.at_y[i]);
+	Lanes rx = Lanes::load(&q.rad_x[i]);
+	Lanes ry = Lanes::load(&q.rad_y[i]);
+
+	Lanes angle = Lanes::load(&q.angle[i]);
+	if (!angle.any_nonzero()) {
+		// unrotated: c = 1, s = 0
+		(ax - rx).store(out[0]);
+		(ay - ry).store(out[1]);
+		(ax - rx).store(out[2]);
+		(ay + ry).store(out[3]);
+		(ax + rx).store(out[4]);
+		(ay - ry).store(out[5]);
+		(ax + rx).store(out[6]);
+		(ay + ry).store(out[7]);
+		return;
+	}
+
+	float c[LANES], s[LANES];
+	for (size_t l = 0; l < LANES; ++l) {
+		c[l] = std::cos(q.angle[i + l]);
+		s[l] = std::sin(q.angle[i + l]);
+	}
+	Lanes A = rx * Lanes::load(c);
+	Lanes B = ry * Lanes::load(s);
+	Lanes C = rx * Lanes::load(s);
+	Lanes D = ry * Lanes::load(c);
+	(ax - A + B).store(out[0]);
+	(ay - C - D).store(out[1]);
+	(ax - A - B).store(out[2]);
+	(ay - C + D).store(out[3]);
+	(ax + A + B).store(out[4]);
+	(ay + C - D).store(out[5]);
+	(ax + A - B).store(out[6]);
+	(ay + C + D).store(out[7]);
+}
+
+// one sprite's vertices at a time, through the Vertex constructor (the tail of write_quads, and builds without SSE2):
+void write_each(QuadArrays const& q, size_t i, size_t count, float const xy[8][LANES], Vertex* out) {
+	for (size_t l = 0; l < count; ++l) {
+		size_t k = i + l;
+		Vertex* v = out + 4 * k;
+		v[0] = Vertex(glm::vec2(xy[0][l], xy[1][l]), glm::vec3(q.min_u[k], q.min_v[k], q.layer[k]), q.tint[k]);
+		v[1] = Vertex(glm::vec2(xy[2][l], xy[3][l]), glm::vec3(q.min_u[k], q.max_v[k], q.layer[k]), q.tint[k]);
+		v[2] = Vertex(glm::vec2(xy[4][l], xy[5][l]), glm::vec3(q.max_u[k], q.min_v[k], q.layer[k]), q.tint[k]);
+		v[3] = Vertex(glm::vec2(xy[6][l], xy[7][l]), glm::vec3(q.max_u[k], q.max_v[k], q.layer[k]), q.tint[k]);
+	}
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+
+// 'a' to 'd' hold four consecutive 32-bit words of four quads' vertices, one lane per quad. Transposes them, so
+// each store writes the four words of one quad, 'stride' floats apart, and vertices come out interleaved:
+inline void store_transposed(__m128 a, __m128 b, __m128 c, __m128 d, float* out, size_t stride) {
+	_MM_TRANSPOSE4_PS(a, b, c, d);
+	_mm_storeu_ps(out, a);
+	_mm_storeu_ps(out + stride, b);
+	_mm_storeu_ps(out + 2 * stride, c);
+	_mm_storeu_ps(out + 3 * stride, d);
+}
+
+#ifdef COMPACT_VERTICES
+// std::round (halfway cases away from zero), as glm::round in the Vertex constructor:
+__m128i round_to_int(__m128 x) {
+	__m128i t = _mm_cvttps_epi32(x);
+	__m128 fraction = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_sub_ps(x, _mm_cvtepi32_ps(t)));
+	__m128i away = _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)));
+	__m128i sign = _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(x), 31), _mm_set1_epi32(1)); // -1 or 1
+	return _mm_add_epi32(t, _mm_and_si128(away, sign));
+}
+
+// two 16-bit values per word, 'low' in the low half:
+__m128 pack_words(__m128i low, __m128i high) {
+	return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(low, _mm_set1_epi32(0xffff)), _mm_slli_epi32(high, 16)));
+}
+#endif
+
+// quads [i, i + LANES), four at a time, with the same values the Vertex constructor would store:
+void write_block(QuadArrays const& q, size_t i, float const xy[8][LANES], Vertex* out) {
+	for (size_t s = 0; s < LANES; s += 4) {
+		size_t k = i + s;
+#ifdef COMPACT_VERTICES
+		__m128 limit = _mm_set1_ps(POSITION_LIMIT);
+		__m128 scale = _mm_set1_ps(POSITION_SCALE);
+		__m128i position[4];
+		for (size_t c = 0; c < 4; ++c) {
+			__m128 x = _mm_loadu_ps(xy[2 * c] + s);
+			__m128 y = _mm_loadu_ps(xy[2 * c + 1] + s);
+			assert(_mm_movemask_ps(_mm_or_ps(_mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), x), limit),
+																			 _mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), y), limit))) == 0
+						 && "compact vertex position out of range");
+			position[c] =
+					_mm_castps_si128(pack_words(round_to_int(_mm_mul_ps(x, scale)), round_to_int(_mm_mul_ps(y, scale))));
+		}
+		auto texcoord = [](float const* p) {
+			__m128 t = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(p), _mm_setzero_ps()), _mm_set1_ps(1.0f));
+			return round_to_int(_mm_mul_ps(t, _mm_set1_ps(65535.0f)));
+		};
+		__m128i u0 = texcoord(&q.min_u[k]), v0 = texcoord(&q.min_v[k]);
+		__m128i u1 = texcoord(&q.max_u[k]), v1 = texcoord(&q.max_v[k]);
+		uint32_t color[4];
+		for (size_t l = 0; l < 4; ++l) {
+			glm::u8vec4 tint = q.tint[k + l];
+			color[l] = uint32_t((tint.x >> 4) << 12 | (tint.y >> 4) << 8 | (tint.z >> 4) << 4 | tint.w >> 4)
+								 | uint32_t(uint16_t(q.layer[k + l])) << 16;
+		}
+		__m128 c = _mm_loadu_ps(reinterpret_cast< float const* >(color));
+		// each quad is 12 words: position, texcoord and color of each vertex:
+		float* o = reinterpret_cast< float* >(out + 4 * k);
+		store_transposed(_mm_castsi128_ps(position[0]), pack_words(u0, v0), c, _mm_castsi128_ps(position[1]), o, 12);
+		store_transposed(pack_words(u0, v1), c, _mm_castsi128_ps(position[2]), pack_words(u1, v0), o + 4, 12);
+		store_transposed(c, _mm_castsi128_ps(position[3]), pack_words(u1, v1), c, o + 8, 12);
+#else
+		__m128 u0 = _mm_loadu_ps(&q.min_u[k]), v0 = _mm_loadu_ps(&q.min_v[k]);
+		__m128 u1 = _mm_loadu_ps(&q.max_u[k]), v1 = _mm_loadu_ps(&q.max_v[k]);
+		__m128 layer = _mm_loadu_ps(&q.layer[k]);
+		__m128 color = _mm_loadu_ps(reinterpret_cast< float const* >(&q.tint[k])); // the four bytes, moved as they are
+		// each quad is 24 words: position, texcoord, layer and color of each vertex:
+		float* o = reinterpret_cast< float* >(out + 4 * k);
+		store_transposed(_mm_loadu_ps(xy[0] + s), _mm_loadu_ps(xy[1] + s), u0, v0, o, 24);
+		store_transposed(layer, color, _mm_loadu_ps(xy[2] + s), _mm_loadu_ps(xy[3] + s), o + 4, 24);
+		store_transposed(u0, v1, layer, color, o + 8, 24);
+		store_transposed(_mm_loadu_ps(xy[4] + s), _mm_loadu_ps(xy[5] + s), u1, v0, o + 12, 24);
+		store_transposed(layer, color, _mm_loadu_ps(xy[6] + s), _mm_loadu_ps(xy[7] + s), o + 16, 24);
+		store_transposed(u1, v1, layer, color, o + 20, 24);
+#endif
+	}
+}
+
+#else
+
+void write_block(QuadArrays const& q, size_t i, float const xy[8][LANES], Vertex* out) {
+	write_each(q, i, LANES, xy, out);
+}
+
+#endif
+
+} // namespace
+
+void write_quads(QuadArrays const& q, Vertex* out) {
+	size_t count = q.size();
+	float xy[8][LANES];
+
+	size_t i = 0;
+	for (; i + LANES <= count; i += LANES) {
+		corners(q, i, xy);
+		write_block(q, i, xy, out);
+	}
+
+	// the last partial block, one sprite at a time:
+	for (; i < count; ++i) {
+		float c = 1.0f, s = 0.0f;
+		if (q.angle[i] != 0.0f) {
+			c = std::cos(q.angle[i]);
+			s = std::sin(q.angle[i]);
+		}
+		float A = q.rad_x[i] * c, B = q.rad_y[i] * s, C = q.rad_x[i] * s, D = q.rad_y[i] * c;
+		float ax = q.at_x[i], ay = q.at_y[i];
+		float tail[8][LANES];
+		tail[0][0] = ax - A + B;
+		tail[1][0] = ay - C - D;
+		tail[2][0] = ax - A - B;
+		tail[3][0] = ay - C + D;
+		tail[4][0] = ax + A + B;
+		tail[5][0] = ay + C - D;
+		tail[6][0] = ax + A - B;
+		tail[7][0] = ay + C + D;
+		write_each(q, i, 1, tail, out);
+	}
+}
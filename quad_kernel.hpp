@@ -0,0 +1,36 @@
+#pragma once
+
+#include "sprites.hpp"
+#include "vertex.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+/*
+ * Quad parameters as structure-of-arrays, and a kernel that turns them into vertices
+ * (four per quad, same corner order as SpriteBatch::draw_sprite) several sprites at a
+ * time: 8 with AVX2, 4 with SSE2, otherwise one. Blocks whose angles are all zero --
+ * nearly every sprite in this game -- skip the sin/cos entirely. With SSE2, vertices are
+ * written four quads at a time by transposing their words and storing them with vector
+ * stores, in either vertex layout, with the same bytes the Vertex constructor stores.
+ */
+
+struct QuadArrays {
+	std::vector<float> at_x, at_y;
+	std::vector<float> rad_x, rad_y;
+	std::vector<float> angle;
+	std::vector<float> min_u, min_v, max_u, max_v;
+	std::vector<float> layer;
+	std::vector<glm::u8vec4> tint;
+
+	size_t size() const { return at_x.size(); }
+	void clear();
+	void reserve(size_t count);
+	void push_back(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at, glm::u8vec4 tint, float angle);
+	// append quad 'i' of 'other':
+	void push_back(QuadArrays const& other, size_t i);
+};
+
+// writes 4 * quads.size() vertices to 'out':
+void write_quads(QuadArrays const& quads, Vertex* out);
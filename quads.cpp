@@ -0,0 +1,31 @@
+#include "quads.hpp"
+
+#include <algorithm>
+#include <vector>
+
+QuadDrawStats quad_draw_stats;
+
+GLuint quad_index_buffer() {
+	static GLuint buffer = 0;
+	if (!buffer) {
+		std::vector<uint16_t> indices;
+		indices.reserve(MAX_BATCH_QUADS * 6);
+		for (uint32_t q = 0; q < MAX_BATCH_QUADS; ++q) {
+			uint16_t v = uint16_t(q * 4);
+			indices.insert(indices.end(), {v, uint16_t(v + 1), uint16_t(v + 2), uint16_t(v + 2), uint16_t(v + 1), uint16_t(v + 3)});
+		}
+		glGenBuffers(1, &buffer);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * indices.size(), &indices[0], GL_STATIC_DRAW);
+	}
+	return buffer;
+}
+
+void draw_quads(GLint first_vertex, GLsizei vertex_count) {
+	for (GLsizei done = 0; done < vertex_count; done += MAX_BATCH_QUADS * 4) {
+		GLsizei quads = std::min< GLsizei >(vertex_count - done, MAX_BATCH_QUADS * 4) / 4;
+		glDrawElementsBaseVertex(GL_TRIANGLES, quads * 6, GL_UNSIGNED_SHORT, nullptr, first_vertex + done);
+		++quad_draw_stats.draw_calls;
+		quad_draw_stats.vertices += quads * 4;
+	}
+}
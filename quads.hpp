@@ -0,0 +1,27 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <stdint.h>
+
+/*
+ * Quads are written as four vertices each -- (-x,-y), (-x,+y), (+x,-y), (+x,+y) -- and
+ * drawn as GL_TRIANGLES through one shared, never-changing index buffer. Indices are
+ * 16 bit, so one index range covers MAX_BATCH_QUADS quads; longer draws are split and
+ * offset with a base vertex.
+ */
+
+const uint32_t MAX_BATCH_QUADS = 65536 / 4;
+
+// the shared index buffer, created on first use. Bind it (as GL_ELEMENT_ARRAY_BUFFER) while each vao is bound:
+GLuint quad_index_buffer();
+
+// draw 'vertex_count' vertices (four per quad) from 'first_vertex' with the bound vao, program and texture:
+void draw_quads(GLint first_vertex, GLsizei vertex_count);
+
+// what draw_quads() has drawn since the counters were last zeroed (e.g. once per frame):
+struct QuadDrawStats {
+	uint32_t draw_calls = 0;
+	uint32_t vertices = 0;
+};
+extern QuadDrawStats quad_draw_stats;
@@ -0,0 +1,186 @@
+#include "region_streamer.hpp"
+#include "load_save_png.hpp"
+#include "atlas.hpp"
+#include "render_state.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+RegionStreamer::RegionStreamer(Level const &level_, std::string const &directory_, size_t budget_)
+		: budget(budget_), level(level_), directory(directory_), state(level_.regions.size(), UNLOADED) {
+	thread = std::thread(&RegionStreamer::run, this);
+}
+
+// note: textures are not deleted here; they go away with the GL context.
+RegionStreamer::~RegionStreamer() {
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	thread.join();
+}
+
+void RegionStreamer::prefetch(uint32_t region) {
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		if (state[region] != UNLOADED) {
+			return;
+		}
+		state[region] = QUEUED;
+		queue.push_back(region);
+	}
+	wake.notify_one();
+}
+
+RegionStreamer::Resident &RegionStreamer::require(uint32_t region) {
+	current = region;
+	auto found = resident.find(region);
+	if (found == resident.end()) {
+		prefetch(region);
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			// move to the front if the loader hasn't picked it up yet:
+			auto queued = std::find(queue.begin(), queue.end(), region);
+			if (queued != queue.end()) {
+				queue.erase(queued);
+				queue.push_front(region);
+			}
+			done.wait(lock, [this, region]() { return state[region] == LOADED; });
+		}
+		update();
+		found = resident.find(region);
+	}
+	found->second.last_used = ++clock;
+	return found->second;
+}
+
+void RegionStreamer::update() {
+	std::vector< Loaded > finished;
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		finished.swap(loaded);
+	}
+	for (Loaded &l : finished) {
+		upload(l);
+	}
+
+	// tile chunks are built as they come into view, so recount:
+	resident_bytes = 0;
+	for (auto const &r : resident) {
+		resident_bytes += r.second.bytes + r.second.tiles.bytes();
+	}
+
+	// evict least recently used regions (never the current one) while over budget:
+	while (resident_bytes > budget) {
+		auto victim = resident.end();
+		for (auto r = resident.begin(); r != resident.end(); ++r) {
+			if (r->first != current && (victim == resident.end() || r->second.last_used < victim->second.last_used)) {
+				victim = r;
+			}
+		}
+		if (victim == resident.end()) {
+			break;
+		}
+		if (victim->second.tex) {
+			render_state.delete_texture(victim->second.tex);
+		}
+		if (victim->second.tileset) {
+			render_state.delete_texture(victim->second.tileset);
+		}
+		resident_bytes -= victim->second.bytes + victim->second.tiles.bytes();
+		victim->second.tiles.clear_buffers();
+		{
+			std::lock_guard< std::mutex > lock(mutex);
+			state[victim->first] = UNLOADED;
+		}
+		resident.erase(victim);
+	}
+}
+
+void RegionStreamer::run() {
+	std::unique_lock< std::mutex > lock(mutex);
+	while (true) {
+		wake.wait(lock, [this]() { return quit || !queue.empty(); });
+		if (quit) {
+			return;
+		}
+		uint32_t region = queue.front();
+		queue.pop_front();
+
+		lock.unlock();
+		Loaded result = load(region);
+		lock.lock();
+
+		state[region] = LOADED;
+		loaded.emplace_back(std::move(result));
+		done.notify_all();
+	}
+}
+
+RegionStreamer::Loaded RegionStreamer::load(uint32_t region) const {
+	Loaded result;
+	result.region = region;
+
+	RegionDef const &def = level.regions[region];
+	std::string image = directory.empty() ? "" : level.string(def.image);
+	if (!image.empty()
+			&& !load_png(directory + "/" + image, &result.size.x, &result.size.y, &result.pixels, LowerLeftOrigin)) {
+		std::cerr << "Failed to load region image '" << image << "', using its atlas sprite." << std::endl;
+		result.pixels.clear();
+	}
+
+	if (def.tile_layer != -1 && !directory.empty()) {
+		TileLayerDef const &layer = level.tile_layers[def.tile_layer];
+		std::string tileset = level.string(layer.tileset);
+		if (load_png(directory + "/" + tileset, &result.tileset_size.x, &result.tileset_size.y, &result.tileset_pixels,
+								 LowerLeftOrigin)) {
+			Tilemap &tiles = result.resident.tiles;
+			tiles.size = layer.size;
+			tiles.tile_size = layer.tile_size;
+			tiles.tileset_grid = layer.tileset_grid;
+			tiles.tiles.assign(level.tiles.begin() + layer.first_tile,
+												 level.tiles.begin() + layer.first_tile + layer.size.x * layer.size.y);
+		} else {
+			std::cerr << "Failed to load tileset '" << tileset << "', skipping tile layer." << std::endl;
+			result.tileset_pixels.clear();
+		}
+	}
+
+	result.resident.boxes.reserve(def.boxes.count);
+	result.resident.box_names.reserve(def.boxes.count);
+	for (uint32_t i = def.boxes.first; i < def.boxes.first + def.boxes.count; ++i) {
+		result.resident.boxes.emplace_back(level.boxes[i].center, level.boxes[i].radius);
+		result.resident.box_names.emplace_back(level.boxes[i].name);
+	}
+
+	result.resident.hints.reserve(def.hints.count);
+	result.resident.hint_texts.reserve(def.hints.count);
+	for (uint32_t i = def.hints.first; i < def.hints.first + def.hints.count; ++i) {
+		result.resident.hints.emplace_back(level.hints[i].center, level.hints[i].radius);
+		result.resident.hint_texts.emplace_back(level.hints[i].text);
+	}
+	return result;
+}
+
+void RegionStreamer::upload(Loaded &l) {
+	Resident &r = resident[l.region];
+	r = std::move(l.resident);
+
+	if (!l.pixels.empty()) {
+		r.tex = upload_texture_layer(l.size, &l.pixels[0]);
+		r.tex_size = l.size;
+	}
+
+	if (!l.tileset_pixels.empty()) {
+		r.tileset = upload_texture_layer(l.tileset_size, &l.tileset_pixels[0]);
+	}
+
+	r.bytes = (l.pixels.size() + l.tileset_pixels.size()) * sizeof(uint32_t)
+			+ r.boxes.size() * (sizeof(BoundingBox) + sizeof(uint32_t)) + r.hints.size() * (sizeof(Circle) + sizeof(uint32_t));
+	r.last_used = ++clock;
+	resident_bytes += r.bytes;
+
+	std::lock_guard< std::mutex > lock(mutex);
+	state[l.region] = RESIDENT;
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "level.hpp"
+#include "geometry.hpp"
+#include "tilemap.hpp"
+#include "GL.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Keeps the per-region background textures, tile layers, collision boxes and hint volumes of a
+ * Level resident on demand. Items and props stay with Game: picking up, placing and spawning
+ * change them, and that has to outlast eviction. Files are read and decoded on a background thread; textures are created
+ * on the GL thread in update(). Regions other than the most recently required one are
+ * evicted least-recently-used first once resident bytes exceed the budget, so memory
+ * use depends on the budget rather than on the size of the world.
+ */
+
+struct RegionStreamer {
+	struct Resident {
+		GLuint tex = 0; // 0 if the region draws its atlas sprite instead
+		glm::uvec2 tex_size = glm::uvec2(0, 0);
+		std::vector< BoundingBox > boxes;
+		std::vector< uint32_t > box_names; // string offsets, parallel to 'boxes'
+		std::vector< Circle > hints;
+		std::vector< uint32_t > hint_texts; // string offsets, parallel to 'hints'
+		GLuint tileset = 0;
+		Tilemap tiles;
+		size_t bytes = 0; // not counting chunk buffers, which tiles.bytes() tracks as they are built
+		uint64_t last_used = 0;
+	};
+
+	// 'directory' is where region images are found, "" to load only collision boxes (no GL needed); 'budget' is in bytes:
+	RegionStreamer(Level const &level, std::string const &directory, size_t budget);
+	~RegionStreamer();
+
+	// queue a background load (no-op if the region is already resident or queued):
+	void prefetch(uint32_t region);
+
+	// make 'region' resident now, waiting for or doing the load if needed.
+	// The reference is valid until the next update():
+	Resident &require(uint32_t region);
+
+	// create textures for finished loads and evict over budget; call once per frame on the GL thread:
+	void update();
+
+	size_t budget;
+	size_t resident_bytes = 0;
+
+private:
+	// decoded but not yet uploaded:
+	struct Loaded {
+		uint32_t region;
+		glm::uvec2 size = glm::uvec2(0, 0);
+		std::vector< uint32_t > pixels;
+		glm::uvec2 tileset_size = glm::uvec2(0, 0);
+		std::vector< uint32_t > tileset_pixels;
+		Resident resident;
+	};
+	enum State : uint8_t {
+		UNLOADED,
+		QUEUED,
+		LOADED,
+		RESIDENT,
+	};
+
+	Loaded load(uint32_t region) const;
+	void upload(Loaded &loaded);
+	void run();
+
+	Level const &level;
+	std::string directory;
+
+	std::map< uint32_t, Resident > resident;
+	uint64_t clock = 0;
+	uint32_t current = -1U;
+
+	// shared with the loader thread:
+	std::mutex mutex;
+	std::condition_variable wake; // signalled when 'queue' grows or on shutdown
+	std::condition_variable done; // signalled when 'loaded' grows
+	std::vector< State > state;
+	std::deque< uint32_t > queue;
+	std::vector< Loaded > loaded;
+	bool quit = false;
+
+	std::thread thread;
+};
@@ -0,0 +1,9 @@
+#include "render_backend.hpp"
+#include "render_state.hpp"
+
+GlBackend gl_backend;
+
+void GlBackend::draw(SpriteBatch const& batch, GLint first, GLsizei count, GLuint texture) {
+	render_state.bind_texture(texture);
+	batch.draw(first, count);
+}
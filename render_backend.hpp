@@ -0,0 +1,24 @@
+#pragma once
+
+#include "sprite_batch.hpp"
+#include "GL.hpp"
+
+/*
+ * Where built sprite quads (four vertices each, see quads.hpp) end up. GlBackend draws
+ * uploaded SpriteBatch ranges through GL with the bound program, as the game does;
+ * SoftwareBackend (software_raster.hpp) rasterizes a batch's 'verts' into memory
+ * without a GL context. Textures are the backend's own handles: GL texture names here,
+ * SoftwareBackend::add_texture() or add_distance_field() results there.
+ */
+
+struct RenderBackend {
+	virtual ~RenderBackend() {}
+
+	// draw vertices [first, first + count) of 'batch' with 'texture':
+	virtual void draw(SpriteBatch const& batch, GLint first, GLsizei count, GLuint texture) = 0;
+};
+
+struct GlBackend : RenderBackend {
+	void draw(SpriteBatch const& batch, GLint first, GLsizei count, GLuint texture) override;
+};
+extern GlBackend gl_backend;
@@ -0,0 +1,120 @@
+#include "render_state.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <stdexcept>
+
+RenderState render_state;
+
+void RenderState::use_program(GLuint program_) {
+	if (program_ != program) {
+		program = program_;
+		glUseProgram(program);
+	}
+}
+
+void RenderState::bind_texture(GLuint texture_) {
+	if (texture_ != texture) {
+		texture = texture_;
+		glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+	}
+}
+
+void RenderState::bind_vertex_array(GLuint vao_) {
+	if (vao_ != vao) {
+		vao = vao_;
+		glBindVertexArray(vao);
+	}
+}
+
+void RenderState::bind_array_buffer(GLuint buffer_) {
+	if (buffer_ != array_buffer) {
+		array_buffer = buffer_;
+		glBindBuffer(GL_ARRAY_BUFFER, array_buffer);
+	}
+}
+
+void RenderState::blend_func(GLenum sfactor_, GLenum dfactor_) {
+	if (!blend) {
+		blend = true;
+		glEnable(GL_BLEND);
+	}
+	if (sfactor_ != sfactor || dfactor_ != dfactor) {
+		sfactor = sfactor_;
+		dfactor = dfactor_;
+		glBlendFunc(sfactor, dfactor);
+	}
+}
+
+void RenderState::clear_color(glm::vec4 const& color_) {
+	if (color_ != color) {
+		color = color_;
+		glClearColor(color.x, color.y, color.z, color.w);
+	}
+}
+
+void RenderState::viewport(glm::ivec4 const& rect_) {
+	if (rect_ != rect) {
+		rect = rect_;
+		glViewport(rect.x, rect.y, rect.z, rect.w);
+	}
+}
+
+void RenderState::delete_texture(GLuint texture_) {
+	if (texture_ == texture) {
+		texture = 0;
+	}
+	glDeleteTextures(1, &texture_);
+}
+
+void RenderState::delete_vertex_array(GLuint vao_) {
+	if (vao_ == vao) {
+		vao = 0;
+	}
+	glDeleteVertexArrays(1, &vao_);
+}
+
+void RenderState::delete_buffer(GLuint buffer_) {
+	if (buffer_ == array_buffer) {
+		array_buffer = 0;
+	}
+	glDeleteBuffers(1, &buffer_);
+}
+
+CameraBlock::CameraBlock() {
+	GLint alignment = 1;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	stride = (sizeof(glm::mat4) + alignment - 1) / alignment * alignment;
+	uploaded.fill(false);
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+	glBufferData(GL_UNIFORM_BUFFER, stride * VIEW_COUNT, nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void CameraBlock::attach(GLuint program) const {
+	GLuint index = glGetUniformBlockIndex(program, "Camera");
+	if (index == GL_INVALID_INDEX) {
+		throw std::runtime_error("no uniform block named Camera");
+	}
+	glUniformBlockBinding(program, index, BINDING);
+}
+
+void CameraBlock::set(View view, glm::mat4 const& mvp_) {
+	if (uploaded[view] && mvp_ == mvp[view]) {
+		return;
+	}
+	mvp[view] = mvp_;
+	uploaded[view] = true;
+	glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, stride * view, sizeof(glm::mat4), glm::value_ptr(mvp[view]));
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void CameraBlock::use(View view) {
+	if (view != current) {
+		current = view;
+		glBindBufferRange(GL_UNIFORM_BUFFER, BINDING, buffer, stride * view, sizeof(glm::mat4));
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <stdint.h>
+
+/*
+ * Shadowed GL state: each setter issues its GL call only if the value differs from the
+ * last one set, so per-draw code can state what it needs without paying for rebinding.
+ * The shadow is only right if every change to this state goes through it, so binds,
+ * and deletes of bound objects, all use 'render_state'. Textures are GL_TEXTURE_2D_ARRAY
+ * on unit 0, the only target and unit the game samples.
+ */
+
+struct RenderState {
+	void use_program(GLuint program);
+	void bind_texture(GLuint texture);
+	void bind_vertex_array(GLuint vao);
+	void bind_array_buffer(GLuint buffer);
+	// enables blending too:
+	void blend_func(GLenum sfactor, GLenum dfactor);
+	void clear_color(glm::vec4 const& color);
+	void viewport(glm::ivec4 const& viewport);
+
+	// delete the object, forgetting it if bound (GL reverts the binding to 0):
+	void delete_texture(GLuint texture);
+	void delete_vertex_array(GLuint vao);
+	void delete_buffer(GLuint buffer);
+
+private:
+	GLuint program = 0;
+	GLuint texture = 0;
+	GLuint vao = 0;
+	GLuint array_buffer = 0;
+	bool blend = false;
+	GLenum sfactor = GL_ONE;
+	GLenum dfactor = GL_ZERO;
+	glm::vec4 color = glm::vec4(0.0f);
+	glm::ivec4 rect = glm::ivec4(-1); // the initial viewport is the window's, so never matches
+};
+extern RenderState render_state;
+
+/*
+ * The 'Camera' uniform block -- layout(std140) uniform Camera { mat4 mvp; }; -- shared by
+ * every program that draws sprites. Each view has its own range of one buffer; a view's
+ * matrix is uploaded only when it changes, and switching views rebinds a range instead
+ * of setting a uniform on each program.
+ */
+
+struct CameraBlock {
+	enum View : uint32_t {
+		WORLD,
+		INTERFACE,
+		CHUNK, // WORLD moved to the origin of the tile chunk being drawn (see Tilemap::draw)
+		VIEW_COUNT,
+	};
+
+	CameraBlock();
+
+	// point 'program's Camera block at this one (throws if it has none):
+	void attach(GLuint program) const;
+
+	void set(View view, glm::mat4 const& mvp);
+	void use(View view);
+
+	static const GLuint BINDING = 0; // uniform buffer binding point
+	GLuint buffer = 0;
+	GLintptr stride = 0; // range size rounded up to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+	std::array<glm::mat4, VIEW_COUNT> mvp;
+	std::array<bool, VIEW_COUNT> uploaded;
+	View current = VIEW_COUNT;
+};
@@ -0,0 +1,62 @@
+#include "render_target.hpp"
+#include "render_state.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+RenderTarget::RenderTarget(glm::uvec2 const& size_, bool integer_scale_) : size(size_), integer_scale(integer_scale_) {
+	glGenRenderbuffers(1, &color);
+	glBindRenderbuffer(GL_RENDERBUFFER, color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("Scene framebuffer is incomplete.");
+	}
+}
+
+void RenderTarget::resize(glm::uvec2 const& size_) {
+	if (size_ == size) {
+		return;
+	}
+	size = size_;
+	// the attachment stays valid; only its storage changes:
+	glBindRenderbuffer(GL_RENDERBUFFER, color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+}
+
+void RenderTarget::bind() const {
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	render_state.viewport(glm::ivec4(0, 0, size.x, size.y));
+}
+
+void RenderTarget::present(glm::uvec2 const& window_size) const {
+	glm::ivec4 viewport = integer_scale ? present_viewport(size, window_size)
+																			: glm::ivec4(0, 0, window_size.x, window_size.y);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	render_state.viewport(glm::ivec4(0, 0, window_size.x, window_size.y));
+	if (viewport.x > 0 || viewport.y > 0) {
+		render_state.clear_color(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		glClear(GL_COLOR_BUFFER_BIT);
+	}
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glBlitFramebuffer(0, 0, size.x, size.y, viewport.x, viewport.y, viewport.x + viewport.z, viewport.y + viewport.w,
+										GL_COLOR_BUFFER_BIT, integer_scale ? GL_NEAREST : GL_LINEAR);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	render_state.viewport(viewport);
+}
+
+glm::ivec4 present_viewport(glm::uvec2 const& size, glm::uvec2 const& window_size) {
+	int scale = int(std::max(1U, std::min(window_size.x / size.x, window_size.y / size.y)));
+	glm::ivec2 scaled = glm::ivec2(size) * scale;
+	glm::ivec2 at = (glm::ivec2(window_size) - scaled) / 2;
+	return glm::ivec4(at.x, at.y, scaled.x, scaled.y);
+}
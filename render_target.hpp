@@ -0,0 +1,35 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+/*
+ * An offscreen color buffer the scene is drawn into, then presented with a single blit.
+ * At the art's native resolution ('integer_scale') the blit is nearest-neighbour and
+ * scaled by the largest whole number that fits the window, so fragment work follows the
+ * art rather than the display and pixels stay square. Otherwise the target is some
+ * fraction of the window (see DynamicResolution) and is stretched over all of it.
+ */
+
+struct RenderTarget {
+	RenderTarget(glm::uvec2 const& size, bool integer_scale);
+
+	// reallocate the color buffer if 'size' differs from the current one:
+	void resize(glm::uvec2 const& size);
+
+	// draw into the target (binds it and sets the viewport to 'size'):
+	void bind() const;
+	// blit to the default framebuffer (with black borders when integer scaling); leaves the
+	// default framebuffer bound with the viewport on the blitted area:
+	void present(glm::uvec2 const& window_size) const;
+
+	glm::uvec2 size;
+	bool integer_scale;
+	GLuint framebuffer = 0;
+	GLuint color = 0; // renderbuffer
+};
+
+// where 'size' lands in a 'window_size' window when integer scaling: the largest integer
+// scale that fits (at least 1), centered. Returns (x, y, width, height) in window pixels:
+glm::ivec4 present_viewport(glm::uvec2 const& size, glm::uvec2 const& window_size);
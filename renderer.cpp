@@ -0,0 +1,179 @@
+#include "renderer.hpp"
+#include "quads.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+VertexAttributes sprite_attributes() {
+	VertexAttributes attributes;
+	attributes.Position = 0;
+	attributes.TexCoord = 1;
+	attributes.Color = 2;
+	return attributes;
+}
+
+} // namespace
+
+Renderer::Renderer(Config const& config, SDL_Window* window, SDL_GLContext context, glm::uvec2 const& drawable_size)
+		: native(config.native_size != glm::uvec2(0)), gpu_budget_ms(config.gpu_budget_ms),
+			atlas(glm::uvec2(320, 240), config.atlas_capacity), attributes(sprite_attributes()),
+			shaderCache(config.shader_cache), shaders(window, context, &shaderCache),
+			scene(native ? config.native_size : drawable_size, native),
+			resolution(config.gpu_budget_ms, config.min_render_scale), worldStatic(attributes, GL_STATIC_DRAW),
+			hudStatic(attributes, GL_STATIC_DRAW), dynamic(attributes, GL_STREAM_DRAW), hintText(attributes, &hintFont),
+			overlay(attributes) {
+	for (std::string const& page : config.atlas_pages) {
+		if (!atlas.add_page(page)) {
+			throw std::runtime_error("Failed to load texture.");
+		}
+	}
+	tex = atlas.tex;
+
+	if (!load_sdf_font(config.hint_font, &hintFont)) {
+		throw std::runtime_error("Failed to load hint font.");
+	}
+
+	shaders.add(&program, "assets/sprite.vert", "assets/sprite.frag", attributes, [this](GLuint program) {
+		GLuint program_tex = glGetUniformLocation(program, "tex");
+		if (program_tex == -1U)
+			throw std::runtime_error("no uniform named tex");
+		cameraBlock.attach(program);
+		glUniform1i(program_tex, 0);
+	});
+	shaders.add(&text_program, "assets/sprite.vert", "assets/text.frag", attributes, [this](GLuint program) {
+		GLuint text_program_tex = glGetUniformLocation(program, "tex");
+		GLuint text_program_background = glGetUniformLocation(program, "background");
+		if (text_program_tex == -1U || text_program_background == -1U)
+			throw std::runtime_error("no uniform named tex or background in text program");
+		cameraBlock.attach(program);
+		glUniform1i(text_program_tex, 0);
+		glm::vec4 background = glm::vec4(HINT_BACKGROUND) / 255.0f;
+		glUniform4f(text_program_background, background.x, background.y, background.z, background.w);
+	});
+	std::cout << "Shaders ready in " << shaderCache.milliseconds << " ms (" << shaderCache.loaded << " programs from '"
+						<< shaderCache.directory << "', " << shaderCache.compiled << " compiled)." << std::endl;
+
+	gpuMs.fill(0.0f);
+	worldList.barriers.set(LAYER_PROPS);
+}
+
+glm::uvec2 Renderer::view_size(glm::uvec2 const& drawable_size) const {
+	return native ? scene.size : drawable_size;
+}
+
+void Renderer::draw(Game& game, glm::uvec2 const& drawable_size, float elapsed,
+										std::chrono::high_resolution_clock::time_point frame_start) {
+	// edited shaders are swapped in here, never mid-frame:
+	shaders.update();
+
+	// GPU times are read back a few frames late; the world's (with its clear) picks its resolution when following the window:
+	gpuTimers[SPAN_CLEAR].poll(&gpuMs[SPAN_CLEAR]);
+	bool worldTimed = gpuTimers[SPAN_WORLD].poll(&gpuMs[SPAN_WORLD]);
+	gpuTimers[SPAN_PRESENT].poll(&gpuMs[SPAN_PRESENT]);
+	gpuTimers[SPAN_INTERFACE].poll(&gpuMs[SPAN_INTERFACE]);
+	if (worldTimed && !native && gpu_budget_ms > 0.0f && resolution.update(gpuMs[SPAN_CLEAR] + gpuMs[SPAN_WORLD])) {
+		std::cout << "Render scale " << resolution.scale << " (world took " << resolution.average_ms << " ms on the GPU)."
+							<< std::endl;
+	}
+	if (!native) {
+		scene.resize(resolution.target_size(drawable_size));
+	}
+	scene.bind();
+	gpuTimers[SPAN_CLEAR].begin();
+	render_state.clear_color(glm::vec4(0.5f, 0.5f, 0.5f, 0.0f));
+	glClear(GL_COLOR_BUFFER_BIT);
+	gpuTimers[SPAN_CLEAR].end();
+	gpuTimers[SPAN_WORLD].begin();
+	render_state.blend_func(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	Level const& level = game.level;
+	RegionStreamer::Resident& background = game.streamer.require(game.currentMap);
+
+	if (staticGame != &game || staticRevision != game.revision) {
+		worldStatic.clear();
+		hudStatic.clear();
+		worldList.clear();
+
+		// the map quad (if any) has its own texture when the region image is streamed:
+		submit_static(game, tex, background.tex, &worldList, &hudStatic);
+
+		// the camera never leaves the region, so the bake only needs culling against the region itself:
+		glm::vec2 regionRadius = level.regions[game.currentMap].radius;
+		staticStats = worldList.emit(-regionRadius, regionRadius, &worldStatic);
+
+		worldStatic.upload();
+		hudStatic.upload();
+		staticGame = &game;
+		staticRevision = game.revision;
+	}
+
+	dynamicList.clear();
+	submit_actors(game, tex, &dynamicList);
+
+	glm::vec2 cameraAt = game.camera.at;
+	glm::vec2 cameraRadius = game.camera.radius;
+	dynamic.clear();
+	DrawList::Stats stats = dynamicList.emit(cameraAt - cameraRadius, cameraAt + cameraRadius, &dynamic);
+	dynamic.upload();
+
+	// uploaded only when the camera moves or resizes; interface sprites are drawn with the camera at the origin:
+	glm::mat4 mvp = camera_mvp(game);
+	cameraBlock.set(CameraBlock::WORLD, mvp);
+	mvp[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	cameraBlock.set(CameraBlock::INTERFACE, mvp);
+
+	render_state.use_program(program);
+	cameraBlock.use(CameraBlock::WORLD);
+
+	worldList.draw(worldStatic, LAYER_BACKGROUND, LAYER_BACKGROUND);
+
+	// only chunks overlapping the view are drawn:
+	if (background.tileset) {
+		render_state.bind_texture(background.tileset);
+		background.tiles.draw(cameraAt - cameraRadius, cameraAt + cameraRadius, attributes, &cameraBlock);
+	}
+
+	worldList.draw(worldStatic, LAYER_PROPS);
+	dynamicList.draw(dynamic);
+
+	gpuTimers[SPAN_WORLD].end();
+	gpuTimers[SPAN_PRESENT].begin();
+	scene.present(drawable_size);
+	gpuTimers[SPAN_PRESENT].end();
+	gpuTimers[SPAN_INTERFACE].begin();
+
+	render_state.bind_texture(tex);
+	cameraBlock.use(CameraBlock::INTERFACE);
+	hudStatic.draw();
+
+	// re-laid out only when the hint changes:
+	if (hint_shown(game)) {
+		render_state.use_program(text_program);
+		render_state.bind_texture(hintFont.tex);
+		hintText.set(game.hint, HINT_AT);
+		hintText.draw();
+	}
+
+	// this frame's counts and CPU time, the GPU times of an earlier one:
+	frame = FrameStats();
+	frame.frame_ms = elapsed * 1000.0f;
+	frame.cpu_ms = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - frame_start).count();
+	frame.gpu_clear_ms = gpuMs[SPAN_CLEAR];
+	frame.gpu_world_ms = gpuMs[SPAN_WORLD];
+	frame.gpu_present_ms = gpuMs[SPAN_PRESENT];
+	frame.gpu_interface_ms = gpuMs[SPAN_INTERFACE];
+	frame.draw_calls = quad_draw_stats.draw_calls;
+	frame.vertices = quad_draw_stats.vertices;
+	frame.sprites_drawn = stats.drawn + staticStats.drawn;
+	frame.sprites_culled = stats.culled + staticStats.culled;
+	overlay.record(frame);
+	if (overlay.visible) {
+		render_state.use_program(program);
+		render_state.bind_texture(tex);
+		overlay.draw(glm::vec2(-cameraRadius.x + 0.25f, cameraRadius.y - 0.25f));
+	}
+	quad_draw_stats = QuadDrawStats();
+	gpuTimers[SPAN_INTERFACE].end();
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "config.hpp"
+#include "game.hpp"
+#include "vertex.hpp"
+#include "sprite_batch.hpp"
+#include "draw_list.hpp"
+#include "scene_sprites.hpp"
+#include "atlas.hpp"
+#include "text.hpp"
+#include "sdf_font.hpp"
+#include "render_target.hpp"
+#include "dynamic_resolution.hpp"
+#include "gpu_timer.hpp"
+#include "perf_overlay.hpp"
+#include "render_state.hpp"
+#include "shader_cache.hpp"
+#include "shader_library.hpp"
+#include "GL.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <array>
+#include <chrono>
+
+/*
+ * Draws a Game into the window: the world offscreen at the native size (or a share of
+ * the window), blown up to the window, then the interface at window resolution. Owns
+ * every GL object the game uses, so it is built once the context exists.
+ */
+
+struct Renderer {
+	// 'context' is the window's, current on the calling thread. Throws if an asset fails to load:
+	Renderer(Config const& config, SDL_Window* window, SDL_GLContext context, glm::uvec2 const& drawable_size);
+
+	// what the camera's aspect ratio follows: the native target, or the window:
+	glm::uvec2 view_size(glm::uvec2 const& drawable_size) const;
+
+	// rebuild the static batches on the next draw(), e.g. for a new Game that may have the old one's address:
+	void invalidate() { staticGame = nullptr; }
+
+	// draw a frame into the default framebuffer (not swapped); 'elapsed' and 'frame_start' time the frame for the overlay:
+	void draw(Game& game, glm::uvec2 const& drawable_size, float elapsed,
+						std::chrono::high_resolution_clock::time_point frame_start);
+
+	bool native;
+	float gpu_budget_ms;
+
+	// sprite atlas: one texture array layer per page (.info coordinates are relative to 320x240):
+	Atlas atlas;
+	GLuint tex = 0;
+	SdfFont hintFont;
+
+	// vertex arrays are shared between programs, so attributes are bound to the same locations in each:
+	VertexAttributes attributes;
+	// both programs read mvp from here:
+	CameraBlock cameraBlock;
+
+	// shader programs, from files that are watched for changes (or from the cache at startup):
+	ShaderCache shaderCache;
+	ShaderLibrary shaders;
+	GLuint program = 0;
+	// distance field text: the same vertex shader, coverage from thresholding the field:
+	GLuint text_program = 0;
+
+	// the world is drawn offscreen and blown up to the window; the interface is drawn over it at window resolution.
+	// At native_size it is integer scaled, otherwise it follows the window, shrunk while over the GPU budget:
+	RenderTarget scene;
+	DynamicResolution resolution;
+
+	// GPU time of each part of the frame, for dynamic resolution and the performance overlay:
+	enum GpuSpan : uint32_t {
+		SPAN_CLEAR,
+		SPAN_WORLD,
+		SPAN_PRESENT,
+		SPAN_INTERFACE,
+		SPAN_COUNT,
+	};
+	std::array<GpuTimer, SPAN_COUNT> gpuTimers;
+	std::array<float, SPAN_COUNT> gpuMs;
+
+	// sprites that only change on interaction or region change are kept on the GPU between frames;
+	// hud sprites are in screen units around the origin. Only the player, held item and hint stream:
+	SpriteBatch worldStatic;
+	SpriteBatch hudStatic;
+	SpriteBatch dynamic;
+	TextRun hintText;
+	PerfOverlay overlay; // toggled with F3
+	FrameStats frame; // the latest draw()'s counts and CPU time
+
+	// sprites are submitted here (see scene_sprites.hpp), culled and sorted before any vertices are written:
+	DrawList worldList;
+	DrawList dynamicList;
+	DrawList::Stats staticStats;
+
+	// the static batches show this game at this revision:
+	Game const* staticGame = nullptr;
+	uint32_t staticRevision = 0;
+};
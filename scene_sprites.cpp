@@ -0,0 +1,80 @@
+#include "scene_sprites.hpp"
+
+void submit_static(Game const& game, GLuint atlas, GLuint background, DrawList* world, SpriteBatch* hud) {
+	Level const& level = game.level;
+
+	if (background) {
+		SpriteData whole;
+		whole.max_uv = glm::vec2(1.0f);
+		world->submit(whole, game.map.radius, game.map.at, LAYER_BACKGROUND, background);
+	} else if (level.regions[game.currentMap].sprite != -1U) {
+		world->submit(game.map.sprite, game.map.radius, game.map.at, LAYER_BACKGROUND, atlas);
+	}
+
+	bool win = game.won();
+
+	if (!win && game.currentMap == game.doorDef.region) {
+		world->submit(game.door.sprite, game.door.radius, game.door.at, LAYER_PROPS, atlas);
+	}
+
+	if (game.currentMap == game.holeDef.region && game.holeDug) {
+		world->submit(game.holeObject.sprite, game.holeObject.radius, game.holeObject.at, LAYER_PROPS, atlas);
+	}
+
+	if (game.currentMap == game.scaleDef.region) {
+		world->submit(game.scale.obj.sprite, game.scale.obj.radius, game.scale.obj.at, LAYER_PROPS, atlas);
+	}
+
+	if (game.hasBridge) {
+		if (game.currentMap == game.bridgeDef.region) {
+			world->submit(game.bridgeObject.sprite, game.bridgeObject.radius, game.bridgeObject.at, LAYER_PROPS, atlas);
+		}
+		hud->draw_sprite(load_sprite(BRIDGE), {0.5f, 0.35f}, glm::vec2(-13.0f, 11.0f));
+	}
+
+	for (const Game::Item& item : game.items[game.currentMap]) {
+		if (&item != game.playerItem) {
+			world->submit(item.obj.sprite, item.obj.radius, item.obj.at, LAYER_ITEMS, atlas);
+		}
+	}
+
+	for (const Game::Pillar& pillar : game.pillars) {
+		if (pillar.filled && pillar.region == game.currentMap) {
+			world->submit(pillar.display.sprite, pillar.display.radius, pillar.display.at, LAYER_ITEMS, atlas);
+		}
+	}
+
+	if (win) {
+		hud->draw_word("YOU WIN", glm::vec2(-3.0f, -8.0f));
+	}
+
+	if (game.hasPickaxe) {
+		hud->draw_sprite(load_sprite(PICKAXE), {0.5f, 0.5f}, glm::vec2(-15.0f, 11.0f));
+	}
+
+	if (game.hasKnife) {
+		hud->draw_sprite(load_sprite(LONG_KNIFE), {0.5f, 0.5f}, glm::vec2(-11.5f, 11.0f));
+	}
+}
+
+void submit_actors(Game const& game, GLuint atlas, DrawList* list) {
+	Game::Object const& player = game.player;
+	if (game.playerItem != nullptr) {
+		list->submit(load_sprite(PLAYER_HOLDING), player.radius, player.at, LAYER_ACTORS, atlas);
+		list->submit(game.playerItem->obj.sprite, game.playerItem->obj.radius, player.at + glm::vec2(0.0f, 0.5f),
+								 LAYER_ACTORS, atlas);
+	} else {
+		list->submit(load_sprite(PLAYER), player.radius, player.at, LAYER_ACTORS, atlas);
+	}
+}
+
+glm::mat4 camera_mvp(Game const& game) {
+	glm::vec2 scale = 1.0f / game.camera.radius;
+	glm::vec2 offset = scale * -game.camera.at;
+	return glm::mat4(glm::vec4(scale.x, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, scale.y, 0.0f, 0.0f),
+									 glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(offset.x, offset.y, 0.0f, 1.0f));
+}
+
+bool hint_shown(Game const& game) {
+	return game.hintTimer < 10.0f;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "game.hpp"
+#include "sprite_batch.hpp"
+#include "draw_list.hpp"
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+/*
+ * What a Game looks like as sprites, shared by Renderer and SoftwareRenderer so both
+ * draw the same frame: the world's sprites go into DrawLists (in world units, culled
+ * later), the interface's into a SpriteBatch in screen units around the origin.
+ * Textures are whatever handles the caller draws with.
+ */
+
+// draw order; tile layers go between the background and the props:
+enum DrawLayer : uint8_t {
+	LAYER_BACKGROUND,
+	LAYER_PROPS,
+	LAYER_ITEMS,
+	LAYER_ACTORS,
+};
+
+// sprites that only change on interaction or region change. The region's map quad uses 'background' if it is
+// nonzero (the streamed region image), otherwise its atlas sprite (if any):
+void submit_static(Game const& game, GLuint atlas, GLuint background, DrawList* world, SpriteBatch* hud);
+// the player and what they hold:
+void submit_actors(Game const& game, GLuint atlas, DrawList* list);
+
+// takes world units to clip space for the game's camera; without the translation, it takes the interface's screen units:
+glm::mat4 camera_mvp(Game const& game);
+
+// the hint line, drawn with the distance field font over HINT_BACKGROUND:
+bool hint_shown(Game const& game);
+const glm::vec2 HINT_AT = glm::vec2(-15.2f, -11.2f);
+const glm::u8vec4 HINT_BACKGROUND = glm::u8vec4(0x27, 0x27, 0xdb, 0xff);
@@ -0,0 +1,87 @@
+#include "sdf_font.hpp"
+#include "atlas.hpp"
+#include "load_save_png.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+SpriteData const& SdfFont::glyph(char c) const {
+	int16_t index = glyph_of[(unsigned char)c];
+	if (index == -1) {
+		index = glyph_of[std::toupper((unsigned char)c)];
+	}
+	if (index == -1) {
+		index = glyph_of[' '];
+	}
+	return glyphs[index];
+}
+
+bool load_sdf_glyphs(std::string const& name, SdfFont* font) {
+	std::ifstream file(name + ".sdf", std::ios::binary);
+
+	struct Header {
+		char magic[4];
+		uint32_t count;
+	} header;
+	static_assert(sizeof(Header) == 8, "Header is packed");
+
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || std::memcmp(header.magic, "sdf0", 4) != 0) {
+		std::cerr << "Font '" << name << ".sdf' is missing or has the wrong magic number" << std::endl;
+		return false;
+	}
+
+	struct Record {
+		uint32_t code;
+		glm::vec2 min_uv;
+		glm::vec2 max_uv;
+	};
+	static_assert(sizeof(Record) == 5 * 4, "Record is packed");
+
+	std::vector<Record> records(header.count);
+	if (records.empty() || !file.read(reinterpret_cast<char*>(&records[0]), records.size() * sizeof(Record))) {
+		std::cerr << "Font '" << name << ".sdf' is truncated" << std::endl;
+		return false;
+	}
+
+	font->glyphs.clear();
+	font->glyph_of.fill(-1);
+	for (Record const& record : records) {
+		if (record.code > 0xff) {
+			std::cerr << "Font '" << name << ".sdf' has a glyph for character " << record.code << ", expected 0-255"
+								<< std::endl;
+			return false;
+		}
+		font->glyph_of[record.code] = int16_t(font->glyphs.size());
+		SpriteData glyph;
+		glyph.min_uv = record.min_uv;
+		glyph.max_uv = record.max_uv;
+		font->glyphs.emplace_back(glyph);
+	}
+	if (font->glyph_of[' '] == -1) {
+		std::cerr << "Font '" << name << ".sdf' has no space glyph" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool load_sdf_font(std::string const& name, SdfFont* font) {
+	if (!load_sdf_glyphs(name, font)) {
+		return false;
+	}
+
+	glm::uvec2 size;
+	std::vector<uint32_t> data;
+	if (!load_png(name + ".png", &size.x, &size.y, &data, LowerLeftOrigin)) {
+		std::cerr << "Failed to load font image '" << name << ".png'" << std::endl;
+		return false;
+	}
+
+	// the field interpolates, so filter it (mipmaps keep small text from aliasing):
+	font->tex = upload_texture_layer(size, &data[0]);
+	glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "sprites.hpp"
+#include "GL.hpp"
+
+#include <array>
+#include <string>
+#include <vector>
+
+/*
+ * A font stored as a signed distance field (built offline from a .font file by
+ * asset-watcher.js). Alpha is 0.5 on glyph outlines, so a shader that thresholds it
+ * draws sharp edges at any scale from this one texture; the texture is linearly
+ * filtered and mipmapped rather than sampled NEAREST like the atlas.
+ */
+
+struct SdfFont {
+	GLuint tex = 0; // one-layer texture array, for the sprite shader's vertex layout
+	std::vector<SpriteData> glyphs;
+	std::array<int16_t, 256> glyph_of; // index into 'glyphs' by character, -1 if the font lacks it
+
+	// lower case falls back to upper case and anything else missing to the space glyph:
+	SpriteData const& glyph(char c) const;
+};
+
+// loads 'name'.png and 'name'.sdf; returns false if either is missing or malformed:
+bool load_sdf_font(std::string const& name, SdfFont* font);
+// only the glyphs, from 'name'.sdf, leaving 'tex' alone (no GL needed):
+bool load_sdf_glyphs(std::string const& name, SdfFont* font);
@@ -0,0 +1,241 @@
+#include "shader_cache.hpp"
+
+#include <SDL.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+// 64-bit FNV-1a:
+uint64_t hash(std::string const& data) {
+	uint64_t h = 0xcbf29ce484222325ULL;
+	for (char c : data) {
+		h = (h ^ uint8_t(c)) * 0x100000001b3ULL;
+	}
+	return h;
+}
+
+std::string gl_string(GLenum name) {
+	GLubyte const* str = glGetString(name);
+	return str ? reinterpret_cast< char const* >(str) : "";
+}
+
+// Binary file layout: magic, the key's length and text (checked on load, in case of hash collisions),
+// then the binary's format, length and bytes:
+const uint32_t MAGIC = 0x306e6270; // "pbn0"
+
+template< typename T >
+bool read(std::istream& in, T* value) {
+	return bool(in.read(reinterpret_cast< char* >(value), sizeof(T)));
+}
+
+template< typename T >
+void write(std::ostream& out, T const& value) {
+	out.write(reinterpret_cast< char const* >(&value), sizeof(T));
+}
+
+void link(GLuint program, GLuint vertex_shader, GLuint fragment_shader, VertexAttributes const* bind) {
+	glAttachShader(program, vertex_shader);
+	glAttachShader(program, fragment_shader);
+	if (bind) {
+		glBindAttribLocation(program, bind->Position, "Position");
+		glBindAttribLocation(program, bind->TexCoord, "TexCoord");
+		glBindAttribLocation(program, bind->Color, "Color");
+	}
+	glLinkProgram(program);
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		std::cerr << "Failed to link shader program." << std::endl;
+		std::cerr << "Info log: " << program_info_log(program);
+		glDeleteProgram(program);
+		throw std::runtime_error("Failed to link program");
+	}
+}
+
+} // namespace
+
+ShaderCache::ShaderCache(std::string const& directory_) : directory(directory_) {
+	driver = gl_string(GL_VENDOR) + "\n" + gl_string(GL_RENDERER) + "\n" + gl_string(GL_VERSION);
+	if (directory.empty()) {
+		return;
+	}
+
+	// a 3.3 context reports GL_INVALID_ENUM here unless the extension is present, leaving 'formats' at 0:
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	while (glGetError() != GL_NO_ERROR) {
+	}
+	if (formats > 0) {
+		get_program_binary = (PFNGLGETPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glGetProgramBinary");
+		program_binary = (PFNGLPROGRAMBINARYPROC)SDL_GL_GetProcAddress("glProgramBinary");
+		program_parameteri = (PFNGLPROGRAMPARAMETERIPROC)SDL_GL_GetProcAddress("glProgramParameteri");
+	}
+	if (!get_program_binary || !program_binary || !program_parameteri) {
+		std::cerr << "NOTE: program binaries aren't supported, shaders will be compiled every launch." << std::endl;
+		directory.clear();
+		return;
+	}
+
+#ifdef _WIN32
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), 0755);
+#endif
+}
+
+GLuint ShaderCache::program(std::string const& vertex_source, std::string const& fragment_source,
+														VertexAttributes const* bind) {
+	auto start = std::chrono::high_resolution_clock::now();
+
+	std::string key = vertex_source + '\0' + fragment_source + '\0';
+	if (bind) {
+		key += std::to_string(bind->Position) + " " + std::to_string(bind->TexCoord) + " " + std::to_string(bind->Color);
+	}
+	key += '\0' + driver;
+	char name[17];
+	std::snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash(key));
+	std::string path = directory + "/" + name + ".bin";
+
+	GLuint program = directory.empty() ? 0 : load(path, key);
+	if (program) {
+		++loaded;
+	} else {
+		// link() deletes the program if it fails; the shaders are deleted either way (0 is ignored):
+		GLuint vertex_shader = 0, fragment_shader = 0;
+		try {
+			vertex_shader = compile_shader(GL_VERTEX_SHADER, vertex_source);
+			fragment_shader = compile_shader(GL_FRAGMENT_SHADER, fragment_source);
+			program = glCreateProgram();
+			if (!directory.empty()) {
+				program_parameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			}
+			link(program, vertex_shader, fragment_shader, bind);
+		} catch (std::runtime_error const&) {
+			glDeleteShader(vertex_shader);
+			glDeleteShader(fragment_shader);
+			throw;
+		}
+		glDeleteShader(vertex_shader);
+		glDeleteShader(fragment_shader);
+		if (!directory.empty()) {
+			save(path, key, program);
+		}
+		++compiled;
+	}
+
+	milliseconds += std::chrono::duration< float, std::milli >(std::chrono::high_resolution_clock::now() - start).count();
+	return program;
+}
+
+GLuint ShaderCache::load(std::string const& path, std::string const& key) const {
+	std::ifstream file(path, std::ios::binary);
+	uint32_t magic = 0, key_length = 0;
+	if (!read(file, &magic) || magic != MAGIC || !read(file, &key_length) || key_length != key.size()) {
+		return 0;
+	}
+	std::string stored(key_length, '\0');
+	GLenum format = 0;
+	uint32_t length = 0;
+	if (!file.read(&stored[0], key_length) || stored != key || !read(file, &format) || !read(file, &length)) {
+		return 0;
+	}
+	std::vector< char > binary(length);
+	if (!file.read(binary.data(), length)) {
+		return 0;
+	}
+
+	// drivers may refuse binaries of their own older versions; that's a miss, not an error:
+	GLuint program = glCreateProgram();
+	program_binary(program, format, binary.data(), length);
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+void ShaderCache::save(std::string const& path, std::string const& key, GLuint program) const {
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0) {
+		return;
+	}
+	std::vector< char > binary(length);
+	GLenum format = 0;
+	get_program_binary(program, length, &length, &format, binary.data());
+
+	// written whole or not at all, so a crash mid-write can't leave a truncated binary for load() to find:
+	std::string temporary = path + ".tmp";
+	{
+		std::ofstream file(temporary, std::ios::binary);
+		write(file, MAGIC);
+		write(file, uint32_t(key.size()));
+		file.write(key.data(), key.size());
+		write(file, format);
+		write(file, uint32_t(length));
+		file.write(binary.data(), length);
+		if (!file) {
+			std::cerr << "Failed to write program binary '" << temporary << "'." << std::endl;
+			return;
+		}
+	}
+	std::remove(path.c_str());
+	if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+		std::cerr << "Failed to write program binary '" << path << "'." << std::endl;
+	}
+}
+
+GLuint compile_shader(GLenum type, std::string const& source) {
+	GLuint shader = glCreateShader(type);
+	GLchar const* str = source.c_str();
+	GLint length = source.size();
+	glShaderSource(shader, 1, &str, &length);
+	glCompileShader(shader);
+	GLint compile_status = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+	if (compile_status != GL_TRUE) {
+		std::cerr << "Failed to compile shader." << std::endl;
+		std::cerr << "Info log: " << shader_info_log(shader);
+		glDeleteShader(shader);
+		throw std::runtime_error("Failed to compile shader.");
+	}
+	return shader;
+}
+
+GLuint link_program(GLuint vertex_shader, GLuint fragment_shader, VertexAttributes const* bind) {
+	GLuint program = glCreateProgram();
+	link(program, vertex_shader, fragment_shader, bind);
+	return program;
+}
+
+std::string shader_info_log(GLuint shader) {
+	GLint info_log_length = 0;
+	glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &info_log_length);
+	std::vector<GLchar> info_log(info_log_length + 1, 0);
+	GLsizei length = 0;
+	glGetShaderInfoLog(shader, info_log.size(), &length, &info_log[0]);
+	return std::string(info_log.begin(), info_log.begin() + length);
+}
+
+std::string program_info_log(GLuint program) {
+	GLint info_log_length = 0;
+	glGetProgramiv(program, GL_INFO_LOG_LENGTH, &info_log_length);
+	std::vector<GLchar> info_log(info_log_length + 1, 0);
+	GLsizei length = 0;
+	glGetProgramInfoLog(program, info_log.size(), &length, &info_log[0]);
+	return std::string(info_log.begin(), info_log.begin() + length);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "vertex.hpp"
+#include "GL.hpp"
+
+#include <stdint.h>
+#include <string>
+
+/*
+ * Links shader programs from GLSL source, keeping each linked program's binary
+ * (glGetProgramBinary) in a cache directory. A binary's file name is a hash of the
+ * sources, the attribute bindings and the GL vendor, renderer and version strings, so
+ * edited shaders and driver updates miss the cache rather than load stale binaries.
+ * A binary the driver rejects anyway is replaced by compiling. Binaries need
+ * GL_ARB_get_program_binary (core in 4.1); without it every program is compiled.
+ */
+
+struct ShaderCache {
+	// 'directory' is created if needed; "" compiles every time:
+	ShaderCache(std::string const& directory);
+
+	// link a program, binding attribute locations to 'bind' if given. Throws if the sources fail to compile or link:
+	GLuint program(std::string const& vertex_source, std::string const& fragment_source,
+								 VertexAttributes const* bind = nullptr);
+
+	// what program() has done so far, for startup timing:
+	uint32_t loaded = 0;   // from cached binaries
+	uint32_t compiled = 0; // from source
+	float milliseconds = 0.0f;
+
+	std::string directory;
+	std::string driver; // vendor, renderer and version, part of every key
+
+private:
+	GLuint load(std::string const& path, std::string const& key) const;
+	void save(std::string const& path, std::string const& key, GLuint program) const;
+
+	// GL 4.1 entry points, looked up at runtime (null if unsupported):
+	PFNGLGETPROGRAMBINARYPROC get_program_binary = nullptr;
+	PFNGLPROGRAMBINARYPROC program_binary = nullptr;
+	PFNGLPROGRAMPARAMETERIPROC program_parameteri = nullptr;
+};
+
+// compile or link, printing the info log and throwing on failure (the failed object is deleted):
+GLuint compile_shader(GLenum type, std::string const& source);
+GLuint link_program(GLuint vertex_shader, GLuint fragment_shader, VertexAttributes const* bind = nullptr);
+
+std::string shader_info_log(GLuint shader);
+std::string program_info_log(GLuint program);
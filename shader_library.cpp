@@ -0,0 +1,279 @@
+#include "shader_library.hpp"
+#include "render_state.hpp"
+
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+typedef void(APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+#endif
+
+namespace {
+
+const std::chrono::milliseconds POLL(250);
+
+// 0 if the file is missing, e.g. while an editor replaces it:
+int64_t modified(std::string const& path) {
+	struct stat info;
+	return stat(path.c_str(), &info) == 0 ? int64_t(info.st_mtime) : 0;
+}
+
+bool read_source(std::string const& path, std::string* source) {
+	std::ifstream file(path, std::ios::binary);
+	std::ostringstream contents;
+	if (!(file && contents << file.rdbuf())) {
+		std::cerr << "Failed to read shader '" << path << "'." << std::endl;
+		return false;
+	}
+	*source = contents.str();
+	return true;
+}
+
+// line numbers in info logs are the file's:
+std::string vertex_source(std::string const& body) {
+	return "#version 330\n" VERTEX_SHADER_INPUTS "#line 1\n" + body;
+}
+std::string fragment_source(std::string const& body) {
+	return "#version 330\n#line 1\n" + body;
+}
+
+} // namespace
+
+ShaderLibrary::ShaderLibrary(SDL_Window* window_, SDL_GLContext context_, ShaderCache* cache_)
+		: window(window_), context(context_), cache(cache_), last_poll(std::chrono::steady_clock::now()) {
+	// creating a context makes it current, so switch back after:
+	SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 1);
+	shared = SDL_GL_CreateContext(window);
+	SDL_GL_SetAttribute(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, 0);
+	SDL_GL_MakeCurrent(window, context);
+
+	// some platforms won't make one window current on two threads, which only the thread can find out:
+	if (shared) {
+		std::promise< bool > started;
+		thread = std::thread(&ShaderLibrary::run, this, &started);
+		background = started.get_future().get();
+		if (!background) {
+			thread.join();
+			SDL_GL_DeleteContext(shared);
+			shared = nullptr;
+		}
+	}
+	if (background) {
+		return;
+	}
+
+	GLint extensions = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+	for (GLint i = 0; i < extensions; ++i) {
+		if (std::string(reinterpret_cast< char const* >(glGetStringi(GL_EXTENSIONS, i))) == "GL_KHR_parallel_shader_compile") {
+			auto max_threads =
+					(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)SDL_GL_GetProcAddress("glMaxShaderCompilerThreadsKHR");
+			if (max_threads) {
+				max_threads(0xffffffff); // as many as the driver likes
+				parallel = true;
+			}
+		}
+	}
+	std::cerr << "NOTE: no shared GL context, shaders will be rebuilt on the render thread"
+						<< (parallel ? " (with parallel compile)." : ".") << std::endl;
+}
+
+// note: programs are not deleted here; they go away with the GL context.
+ShaderLibrary::~ShaderLibrary() {
+	if (!background) {
+		return;
+	}
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	thread.join();
+	SDL_GL_DeleteContext(shared);
+}
+
+void ShaderLibrary::add(GLuint* program, std::string const& vertex_file, std::string const& fragment_file,
+												VertexAttributes const& bind, std::function< void(GLuint) > const& setup) {
+	Entry entry;
+	entry.program = program;
+	entry.vertex_file = vertex_file;
+	entry.fragment_file = fragment_file;
+	entry.bind = bind;
+	entry.setup = setup;
+	// before reading, so an edit made meanwhile is rebuilt:
+	entry.vertex_time = modified(vertex_file);
+	entry.fragment_time = modified(fragment_file);
+
+	std::string vertex, fragment;
+	if (!read_source(vertex_file, &vertex) || !read_source(fragment_file, &fragment)) {
+		throw std::runtime_error("Failed to read shaders.");
+	}
+	*program = cache->program(vertex_source(vertex), fragment_source(fragment), &bind);
+	render_state.use_program(*program);
+	setup(*program);
+
+	std::lock_guard< std::mutex > lock(mutex);
+	entries.emplace_back(entry);
+}
+
+void ShaderLibrary::update() {
+	if (background) {
+		std::vector< Built > finished;
+		{
+			std::lock_guard< std::mutex > lock(mutex);
+			finished.swap(built);
+		}
+		for (Built const& b : finished) {
+			swap_in(entries[b.entry], b.program);
+		}
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+	if (now - last_poll >= POLL) {
+		last_poll = now;
+		for (Entry& entry : entries) {
+			if (!entry.pending && changed(entry)) {
+				start(entry);
+			}
+		}
+	}
+	for (Entry& entry : entries) {
+		if (entry.pending) {
+			GLint done = GL_TRUE;
+			if (parallel) {
+				glGetProgramiv(entry.pending, GL_COMPLETION_STATUS_KHR, &done);
+			}
+			if (done) {
+				finish(entry);
+			}
+		}
+	}
+}
+
+bool ShaderLibrary::changed(Entry& entry) {
+	int64_t vertex_time = modified(entry.vertex_file);
+	int64_t fragment_time = modified(entry.fragment_file);
+	if (!vertex_time || !fragment_time || (vertex_time == entry.vertex_time && fragment_time == entry.fragment_time)) {
+		return false;
+	}
+	entry.vertex_time = vertex_time;
+	entry.fragment_time = fragment_time;
+	return true;
+}
+
+void ShaderLibrary::swap_in(Entry& entry, GLuint program) {
+	render_state.use_program(program);
+	try {
+		entry.setup(program);
+	} catch (std::runtime_error const& e) {
+		std::cerr << "Rebuilt '" << entry.vertex_file << "' + '" << entry.fragment_file << "' can't be used (" << e.what()
+							<< "), keeping the previous build." << std::endl;
+		render_state.use_program(*entry.program);
+		glDeleteProgram(program);
+		return;
+	}
+	// (not in use, so deleted right away):
+	glDeleteProgram(*entry.program);
+	*entry.program = program;
+	std::cout << "Rebuilt '" << entry.vertex_file << "' + '" << entry.fragment_file << "'." << std::endl;
+}
+
+void ShaderLibrary::run(std::promise< bool >* started) {
+	bool current = SDL_GL_MakeCurrent(window, shared) == 0;
+	started->set_value(current);
+	if (!current) {
+		return;
+	}
+
+	std::unique_lock< std::mutex > lock(mutex);
+	while (!wake.wait_for(lock, POLL, [this]() { return quit; })) {
+		for (uint32_t i = 0; i < entries.size(); ++i) {
+			if (!changed(entries[i])) {
+				continue;
+			}
+			Entry entry = entries[i];
+			lock.unlock();
+
+			GLuint program = 0;
+			std::string vertex, fragment;
+			if (read_source(entry.vertex_file, &vertex) && read_source(entry.fragment_file, &fragment)) {
+				GLuint vertex_shader = 0, fragment_shader = 0;
+				try {
+					vertex_shader = compile_shader(GL_VERTEX_SHADER, vertex_source(vertex));
+					fragment_shader = compile_shader(GL_FRAGMENT_SHADER, fragment_source(fragment));
+					program = link_program(vertex_shader, fragment_shader, &entry.bind);
+				} catch (std::runtime_error const&) {
+					std::cerr << "Failed to rebuild '" << entry.vertex_file << "' + '" << entry.fragment_file
+										<< "', keeping the previous build." << std::endl;
+				}
+				glDeleteShader(vertex_shader);
+				glDeleteShader(fragment_shader);
+			}
+			// the GL thread may only use the program once this context has finished building it:
+			glFinish();
+
+			lock.lock();
+			if (program) {
+				built.push_back(Built{i, program});
+			}
+		}
+	}
+	SDL_GL_MakeCurrent(window, nullptr);
+}
+
+void ShaderLibrary::start(Entry& entry) {
+	std::string vertex, fragment;
+	if (!read_source(entry.vertex_file, &vertex) || !read_source(entry.fragment_file, &fragment)) {
+		return;
+	}
+	// no status queries until finish(), so a parallel compiling driver doesn't have to wait:
+	auto shader = [](GLenum type, std::string const& source) {
+		GLuint shader = glCreateShader(type);
+		GLchar const* str = source.c_str();
+		GLint length = source.size();
+		glShaderSource(shader, 1, &str, &length);
+		glCompileShader(shader);
+		return shader;
+	};
+	entry.pending_vertex = shader(GL_VERTEX_SHADER, vertex_source(vertex));
+	entry.pending_fragment = shader(GL_FRAGMENT_SHADER, fragment_source(fragment));
+	entry.pending = glCreateProgram();
+	glAttachShader(entry.pending, entry.pending_vertex);
+	glAttachShader(entry.pending, entry.pending_fragment);
+	glBindAttribLocation(entry.pending, entry.bind.Position, "Position");
+	glBindAttribLocation(entry.pending, entry.bind.TexCoord, "TexCoord");
+	glBindAttribLocation(entry.pending, entry.bind.Color, "Color");
+	glLinkProgram(entry.pending);
+}
+
+void ShaderLibrary::finish(Entry& entry) {
+	GLint vertex_status = GL_FALSE, fragment_status = GL_FALSE, link_status = GL_FALSE;
+	glGetShaderiv(entry.pending_vertex, GL_COMPILE_STATUS, &vertex_status);
+	glGetShaderiv(entry.pending_fragment, GL_COMPILE_STATUS, &fragment_status);
+	glGetProgramiv(entry.pending, GL_LINK_STATUS, &link_status);
+	if (vertex_status != GL_TRUE) {
+		std::cerr << "Failed to compile '" << entry.vertex_file << "':\n" << shader_info_log(entry.pending_vertex);
+	} else if (fragment_status != GL_TRUE) {
+		std::cerr << "Failed to compile '" << entry.fragment_file << "':\n" << shader_info_log(entry.pending_fragment);
+	} else if (link_status != GL_TRUE) {
+		std::cerr << "Failed to link '" << entry.vertex_file << "' + '" << entry.fragment_file << "':\n"
+							<< program_info_log(entry.pending);
+	}
+	glDeleteShader(entry.pending_vertex);
+	glDeleteShader(entry.pending_fragment);
+	if (link_status == GL_TRUE) {
+		swap_in(entry, entry.pending);
+	} else {
+		std::cerr << "Keeping the previous build." << std::endl;
+		glDeleteProgram(entry.pending);
+	}
+	entry.pending = entry.pending_vertex = entry.pending_fragment = 0;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "shader_cache.hpp"
+#include "vertex.hpp"
+#include "GL.hpp"
+
+#include <SDL.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Shader programs built from GLSL files and rebuilt when the files change. A file holds
+ * everything after the #version line. Vertex shaders also get VERTEX_SHADER_INPUTS (see
+ * vertex.hpp). Attributes are bound to fixed locations, so vertex arrays stay valid
+ * across rebuilds.
+ *
+ * Changes are found by polling modification times. If a context sharing objects with
+ * the window's can be made current on another thread, a background thread polls and
+ * compiles on it. Otherwise update() polls and starts compiles on the GL thread. With
+ * GL_KHR_parallel_shader_compile the driver then finishes them on its own threads.
+ * Either way a rebuilt program replaces the old one only in update(), between frames,
+ * after which its 'setup' re-resolves uniforms. A program that fails to build is
+ * reported, and the old one is kept. The background thread binds nothing, so it never
+ * touches 'render_state', which shadows the window context's state for the GL thread.
+ */
+
+struct ShaderLibrary {
+	// 'context' is the window's, current on the calling thread:
+	ShaderLibrary(SDL_Window* window, SDL_GLContext context, ShaderCache* cache);
+	~ShaderLibrary();
+
+	// build a program now (through 'cache'), throwing if it fails, since there is no old one to keep.
+	// '*program' then always holds the latest build; 'setup' is called with each build in use, to look up
+	// and set its uniforms:
+	void add(GLuint* program, std::string const& vertex_file, std::string const& fragment_file,
+					 VertexAttributes const& bind, std::function< void(GLuint) > const& setup);
+
+	// swap in rebuilt programs (without a background thread, also poll for changes); call between frames:
+	void update();
+
+	bool background = false; // rebuilding on a shared context, on 'thread'
+
+private:
+	struct Entry {
+		GLuint* program;
+		std::string vertex_file;
+		std::string fragment_file;
+		VertexAttributes bind;
+		std::function< void(GLuint) > setup;
+		int64_t vertex_time = 0; // modification times of the sources last built
+		int64_t fragment_time = 0;
+		// on the GL thread, a build waiting for the driver:
+		GLuint pending = 0;
+		GLuint pending_vertex = 0;
+		GLuint pending_fragment = 0;
+	};
+	struct Built {
+		uint32_t entry;
+		GLuint program;
+	};
+
+	// note new modification times, returning true if either changed:
+	bool changed(Entry& entry);
+	void swap_in(Entry& entry, GLuint program);
+	void run(std::promise< bool >* started); // background thread; reports whether it has the shared context
+	void start(Entry& entry); // GL thread builds
+	void finish(Entry& entry);
+
+	SDL_Window* window;
+	SDL_GLContext context;
+	ShaderCache* cache;
+	SDL_GLContext shared = nullptr;
+	bool parallel = false; // GL_KHR_parallel_shader_compile
+	std::chrono::steady_clock::time_point last_poll;
+
+	std::vector< Entry > entries; // the background thread reads these (and writes the times) under 'mutex'
+	std::mutex mutex;
+	std::condition_variable wake; // signalled on shutdown
+	std::vector< Built > built;
+	bool quit = false;
+	std::thread thread;
+};
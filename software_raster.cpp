@@ -0,0 +1,401 @@
+#include "software_raster.hpp"
+#include "load_save_png.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// round(a * b / 255) for bytes, exactly:
+inline uint32_t mul255(uint32_t a, uint32_t b) {
+	uint32_t p = a * b + 128;
+	return (p + (p >> 8)) >> 8;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+// the same for 16-bit lanes holding bytes:
+inline __m128i mul255(__m128i a, __m128i b) {
+	__m128i p = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+// (texel * color) over dst, for two pixels widened to 16-bit lanes:
+inline __m128i blend(__m128i texel, __m128i color, __m128i dst) {
+	__m128i src = mul255(texel, color);
+	__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_add_epi16(mul255(src, alpha), mul255(dst, _mm_sub_epi16(_mm_set1_epi16(255), alpha)));
+}
+#endif
+
+const uint32_t BLACK = 0xff000000; // what GL samples from no texture
+
+// pixels [x_begin, x_end) of row 'y' covered by 'q':
+void fill_span(SoftwareBackend::Quad const& q, SoftwareBackend::Texture const* texture, int32_t y, int32_t x_begin,
+							 int32_t x_end, uint32_t* row) {
+	float py = float(y) + 0.5f;
+	float s_row = q.s.y * py + q.s.z;
+	float t_row = q.t.y * py + q.t.z;
+	float u_row = q.u.y * py + q.u.z;
+	float v_row = q.v.y * py + q.v.z;
+	uint32_t const* texels = texture ? &texture->texels[size_t(q.layer) * texture->size.x * texture->size.y] : nullptr;
+	float max_u = texture ? float(texture->size.x - 1) : 0.0f;
+	float max_v = texture ? float(texture->size.y - 1) : 0.0f;
+
+#if defined(__SSE2__) || defined(_M_X64)
+	// whole groups of four from an aligned start (still within the tile, or the row padding), with lanes outside
+	// [x_begin, x_end) masked off as the scalar loop would skip them:
+	__m128i index = _mm_setr_epi32(0, 1, 2, 3);
+	__m128i span_begin = _mm_set1_epi32(x_begin - 1);
+	__m128i span_end = _mm_set1_epi32(x_end);
+	__m128 zero = _mm_setzero_ps();
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 lane = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	__m128i color = _mm_set_epi16(q.color.w, q.color.z, q.color.y, q.color.x, q.color.w, q.color.z, q.color.y, q.color.x);
+	__m128i none = _mm_setzero_si128();
+	for (int32_t x = x_begin & ~3; x < x_end; x += 4) {
+		__m128 px = _mm_add_ps(_mm_set1_ps(float(x)), lane);
+		__m128 s = _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(q.s.x)), _mm_set1_ps(s_row));
+		__m128 t = _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(q.t.x)), _mm_set1_ps(t_row));
+		__m128i xs = _mm_add_epi32(_mm_set1_epi32(x), index);
+		__m128 in_span = _mm_castsi128_ps(_mm_and_si128(_mm_cmpgt_epi32(xs, span_begin), _mm_cmpgt_epi32(span_end, xs)));
+		__m128 inside = _mm_and_ps(_mm_and_ps(_mm_and_ps(_mm_cmpge_ps(s, zero), _mm_cmplt_ps(s, one)),
+																					_mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmplt_ps(t, one))),
+															 in_span);
+		if (!_mm_movemask_ps(inside)) {
+			continue;
+		}
+
+		__m128i texel;
+		if (texels) {
+			// clamped first, so truncation is floor:
+			__m128 u = _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(q.u.x)), _mm_set1_ps(u_row));
+			__m128 v = _mm_add_ps(_mm_mul_ps(px, _mm_set1_ps(q.v.x)), _mm_set1_ps(v_row));
+			u = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(u, zero), _mm_set1_ps(max_u))));
+			v = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(v, zero), _mm_set1_ps(max_v))));
+			__m128i texel_index = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(float(texture->size.x))), u));
+			alignas(16) int32_t i[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(i), texel_index);
+			texel = _mm_setr_epi32(texels[i[0]], texels[i[1]], texels[i[2]], texels[i[3]]);
+		} else {
+			texel = _mm_set1_epi32(int32_t(BLACK));
+		}
+
+		__m128i* at = reinterpret_cast<__m128i*>(row + x);
+		__m128i dst = _mm_loadu_si128(at);
+		__m128i lo = blend(_mm_unpacklo_epi8(texel, none), color, _mm_unpacklo_epi8(dst, none));
+		__m128i hi = blend(_mm_unpackhi_epi8(texel, none), color, _mm_unpackhi_epi8(dst, none));
+		__m128i mask = _mm_castps_si128(inside);
+		__m128i out = _mm_or_si128(_mm_and_si128(mask, _mm_packus_epi16(lo, hi)), _mm_andnot_si128(mask, dst));
+		_mm_storeu_si128(at, out);
+	}
+#else
+	for (int32_t x = x_begin; x < x_end; ++x) {
+		float px = float(x) + 0.5f;
+		float s = q.s.x * px + s_row;
+		float t = q.t.x * px + t_row;
+		if (!(s >= 0.0f && s < 1.0f && t >= 0.0f && t < 1.0f)) {
+			continue;
+		}
+		uint32_t texel = BLACK;
+		if (texels) {
+			float u = std::min(std::max(q.u.x * px + u_row, 0.0f), max_u);
+			float v = std::min(std::max(q.v.x * px + v_row, 0.0f), max_v);
+			texel = texels[uint32_t(v) * texture->size.x + uint32_t(u)];
+		}
+		uint32_t src[4], alpha;
+		for (uint32_t c = 0; c < 4; ++c) {
+			src[c] = mul255(texel >> (8 * c) & 0xff, q.color[c]);
+		}
+		alpha = src[3];
+		uint32_t out = 0;
+		for (uint32_t c = 0; c < 4; ++c) {
+			out |= (mul255(src[c], alpha) + mul255(row[x] >> (8 * c) & 0xff, 255 - alpha)) << (8 * c);
+		}
+		row[x] = out;
+	}
+#endif
+}
+
+// bilinear, clamped to the edge, from level 'level' of a distance field; (u, v) in level 0 texels:
+float sample_field(SoftwareBackend::Texture const& texture, uint32_t level, float u, float v) {
+	glm::uvec2 size = texture.field_sizes[level];
+	std::vector<float> const& alpha = texture.field[level];
+	float x = u * float(size.x) / float(texture.size.x) - 0.5f;
+	float y = v * float(size.y) / float(texture.size.y) - 0.5f;
+	float fx = std::floor(x), fy = std::floor(y);
+	int32_t x0 = int32_t(fx), y0 = int32_t(fy);
+	auto at = [&](int32_t ix, int32_t iy) {
+		ix = std::min(std::max(ix, 0), int32_t(size.x) - 1);
+		iy = std::min(std::max(iy, 0), int32_t(size.y) - 1);
+		return alpha[size_t(iy) * size.x + ix];
+	};
+	float bottom = at(x0, y0) + (at(x0 + 1, y0) - at(x0, y0)) * (x - fx);
+	float top = at(x0, y0 + 1) + (at(x0 + 1, y0 + 1) - at(x0, y0 + 1)) * (x - fx);
+	return bottom + (top - bottom) * (y - fy);
+}
+
+// pixels [x_begin, x_end) of row 'y' covered by 'q', as text.frag colors them from a distance field:
+void fill_field_span(SoftwareBackend::Quad const& q, SoftwareBackend::Texture const& texture, int32_t y,
+										 int32_t x_begin, int32_t x_end, uint32_t* row) {
+	// the quad maps pixels to texels affinely, so the level of detail is the same everywhere on it:
+	float rho = std::max(std::sqrt(q.u.x * q.u.x + q.v.x * q.v.x), std::sqrt(q.u.y * q.u.y + q.v.y * q.v.y));
+	float lambda = std::min(std::max(std::log2(rho), 0.0f), float(texture.field.size() - 1));
+	uint32_t level = uint32_t(lambda);
+	uint32_t next = std::min(level + 1, uint32_t(texture.field.size() - 1));
+	float blend = lambda - float(level);
+	auto field = [&](int32_t x, int32_t y) {
+		float px = float(x) + 0.5f, py = float(y) + 0.5f;
+		float u = q.u.x * px + q.u.y * py + q.u.z;
+		float v = q.v.x * px + q.v.y * py + q.v.z;
+		float a = sample_field(texture, level, u, v);
+		return a + (sample_field(texture, next, u, v) - a) * blend;
+	};
+
+	glm::vec4 color = glm::vec4(q.color) / 255.0f;
+	glm::vec4 background = glm::vec4(texture.background) / 255.0f;
+	float py = float(y) + 0.5f;
+	for (int32_t x = x_begin; x < x_end; ++x) {
+		float px = float(x) + 0.5f;
+		float s = q.s.x * px + q.s.y * py + q.s.z;
+		float t = q.t.x * px + q.t.y * py + q.t.z;
+		if (!(s >= 0.0f && s < 1.0f && t >= 0.0f && t < 1.0f)) {
+			continue;
+		}
+		// fwidth from differences across the 2x2 pixel quad, as fragment shaders take it:
+		float a = field(x, y);
+		int32_t qx = x & ~1, qy = y & ~1;
+		float edge = 0.7f * (std::abs(field(qx + 1, y) - field(qx, y)) + std::abs(field(x, qy + 1) - field(x, qy)));
+		float ink = float(a >= 0.5f);
+		if (edge > 0.0f) {
+			ink = std::min(std::max((a - (0.5f - edge)) / (2.0f * edge), 0.0f), 1.0f);
+			ink = ink * ink * (3.0f - 2.0f * ink); // smoothstep
+		}
+		glm::vec4 src = background + (color - background) * ink;
+		uint32_t out = 0;
+		for (uint32_t c = 0; c < 4; ++c) {
+			float dst = float(row[x] >> (8 * c) & 0xff) / 255.0f;
+			float blended = src[c] * src.w + dst * (1.0f - src.w);
+			out |= uint32_t(std::min(std::max(blended, 0.0f), 1.0f) * 255.0f + 0.5f) << (8 * c);
+		}
+		row[x] = out;
+	}
+}
+
+const uint32_t SUBPIXELS = 256; // per pixel, each way
+
+// 'plane' (0 on one edge, 1 on the other) remapped so that [0, 1) holds the pixels the fill rule covers:
+glm::vec3 fill_rule(glm::vec3 const& plane) {
+	float margin = 0.5f / float(SUBPIXELS) * std::sqrt(plane.x * plane.x + plane.y * plane.y);
+	// the inside is up the gradient from the 0 edge, and down it from the 1 edge:
+	bool left_or_bottom = plane.x > 0.0f || (plane.x == 0.0f && plane.y > 0.0f);
+	float low = left_or_bottom ? -margin : margin;
+	float high = left_or_bottom ? 1.0f - margin : 1.0f + margin;
+	return (plane - glm::vec3(0.0f, 0.0f, low)) / (high - low);
+}
+
+} // namespace
+
+SoftwareBackend::SoftwareBackend(glm::uvec2 const& size_, uint32_t threads_)
+		: viewport(0, 0, size_.x, size_.y), size(size_),
+			threads(threads_ ? threads_ : std::max(1U, std::thread::hardware_concurrency())), stride((size_.x + 3) & ~3U), pixels(size_t(stride) * size_.y, 0) {}
+
+GLuint SoftwareBackend::add_texture(glm::uvec2 const& size_, uint32_t layers, uint32_t const* texels) {
+	Texture texture;
+	texture.size = size_;
+	texture.layers = layers;
+	texture.texels.assign(texels, texels + size_t(size_.x) * size_.y * layers);
+	textures.emplace_back(std::move(texture));
+	return GLuint(textures.size()); // 0 stays "no texture", as in GL
+}
+
+GLuint SoftwareBackend::add_distance_field(glm::uvec2 const& size_, uint32_t const* texels, glm::u8vec4 const& background) {
+	Texture texture;
+	texture.size = size_;
+	texture.layers = 1;
+	texture.background = background;
+	// level 0 from the alpha channel, then each level the 2x2 box average of the one before, down to 1x1:
+	texture.field_sizes.emplace_back(size_);
+	texture.field.emplace_back(size_t(size_.x) * size_.y);
+	for (size_t i = 0; i < texture.field[0].size(); ++i) {
+		texture.field[0][i] = float(texels[i] >> 24) / 255.0f;
+	}
+	while (texture.field_sizes.back() != glm::uvec2(1, 1)) {
+		glm::uvec2 from = texture.field_sizes.back();
+		glm::uvec2 to = glm::max(from / 2U, glm::uvec2(1, 1));
+		std::vector<float> const& above = texture.field.back();
+		std::vector<float> level(size_t(to.x) * to.y);
+		for (uint32_t y = 0; y < to.y; ++y) {
+			for (uint32_t x = 0; x < to.x; ++x) {
+				uint32_t x0 = std::min(2 * x, from.x - 1), x1 = std::min(2 * x + 1, from.x - 1);
+				uint32_t y0 = std::min(2 * y, from.y - 1), y1 = std::min(2 * y + 1, from.y - 1);
+				level[size_t(y) * to.x + x] = 0.25f * (above[size_t(y0) * from.x + x0] + above[size_t(y0) * from.x + x1] +
+																							 above[size_t(y1) * from.x + x0] + above[size_t(y1) * from.x + x1]);
+			}
+		}
+		texture.field_sizes.emplace_back(to);
+		texture.field.emplace_back(std::move(level));
+	}
+	textures.emplace_back(std::move(texture));
+	return GLuint(textures.size());
+}
+
+void SoftwareBackend::clear(glm::u8vec4 const& color) {
+	finish();
+	std::fill(pixels.begin(), pixels.end(), uint32_t(color.x) | uint32_t(color.y) << 8 | uint32_t(color.z) << 16 | uint32_t(color.w) << 24);
+}
+
+void SoftwareBackend::draw(SpriteBatch const& batch, GLint first, GLsizei count, GLuint texture) {
+	uint32_t index = texture >= 1 && texture <= textures.size() ? texture - 1 : -1U;
+	Texture const* tex = index != -1U ? &textures[index] : nullptr;
+	glm::vec2 scale = 0.5f * glm::vec2(viewport.z, viewport.w);
+	glm::vec2 origin = glm::vec2(viewport.x, viewport.y);
+
+	for (GLsizei i = 0; i + 4 <= count; i += 4) {
+		Vertex const* quad = &batch.verts[first + i];
+		// corners (-,-), (-,+), (+,-) in pixels; the fourth completes the parallelogram:
+		glm::vec2 p[4];
+		for (uint32_t c = 0; c < 3; ++c) {
+			glm::vec4 clip = mvp * glm::vec4(vertex_position(quad[c]), 0.0f, 1.0f);
+			p[c] = (glm::vec2(clip.x, clip.y) + glm::vec2(1.0f)) * scale + origin;
+			// snapped to the subpixel grid, as GL rasterizers do:
+			p[c] = glm::vec2(std::round(p[c].x * SUBPIXELS), std::round(p[c].y * SUBPIXELS)) / float(SUBPIXELS);
+		}
+		p[3] = p[1] + p[2] - p[0];
+		glm::vec2 es = p[2] - p[0];
+		glm::vec2 et = p[1] - p[0];
+		float det = es.x * et.y - es.y * et.x;
+		if (std::abs(det) < 1e-6f) {
+			continue; // no area (e.g. items hidden with radius.x = 0)
+		}
+
+		Quad q;
+		// solving p = p[0] + s * es + t * et:
+		q.s = glm::vec3(et.y, -et.x, p[0].y * et.x - p[0].x * et.y) / det;
+		q.t = glm::vec3(-es.y, es.x, es.y * p[0].x - es.x * p[0].y) / det;
+
+		glm::vec2 lo = glm::min(glm::min(p[0], p[1]), glm::min(p[2], p[3]));
+		glm::vec2 hi = glm::max(glm::max(p[0], p[1]), glm::max(p[2], p[3]));
+		// pixels whose centers can be inside (or on an edge):
+		glm::ivec4 clip(std::max(0, viewport.x), std::max(0, viewport.y), std::min(int32_t(size.x), viewport.x + viewport.z),
+										std::min(int32_t(size.y), viewport.y + viewport.w));
+		q.bounds = glm::ivec4(std::max(clip.x, int32_t(std::ceil(lo.x - 0.5f))), std::max(clip.y, int32_t(std::ceil(lo.y - 0.5f))),
+													std::min(clip.z, int32_t(std::floor(hi.x - 0.5f)) + 1),
+													std::min(clip.w, int32_t(std::floor(hi.y - 0.5f)) + 1));
+		if (q.bounds.x >= q.bounds.z || q.bounds.y >= q.bounds.w) {
+			continue;
+		}
+
+		q.texture = index;
+		q.color = vertex_color(quad[0]);
+		q.layer = 0;
+		q.u = q.v = glm::vec3(0.0f);
+		if (tex) {
+			glm::vec3 uv0 = vertex_texcoord(quad[0]);
+			glm::vec3 uv1 = vertex_texcoord(quad[1]);
+			glm::vec3 uv2 = vertex_texcoord(quad[2]);
+			q.u = (glm::vec3(0.0f, 0.0f, uv0.x) + q.s * (uv2.x - uv0.x) + q.t * (uv1.x - uv0.x)) * float(tex->size.x);
+			q.v = (glm::vec3(0.0f, 0.0f, uv0.y) + q.s * (uv2.y - uv0.y) + q.t * (uv1.y - uv0.y)) * float(tex->size.y);
+			q.layer = std::min(uint32_t(std::max(uv0.z + 0.5f, 0.0f)), tex->layers - 1);
+		}
+		// pixel centers exactly on an edge are covered if it is a left edge, or a bottom one, so quads sharing an
+		// edge cover each pixel once. Once the texel planes are set, the coverage planes are moved half a subpixel
+		// in or out at each edge (rounding error is far less) so fill_span()'s [0, 1) test does that:
+		q.s = fill_rule(q.s);
+		q.t = fill_rule(q.t);
+		quads.emplace_back(q);
+	}
+}
+
+void SoftwareBackend::blit(glm::uvec2 const& from_size, uint32_t const* from, glm::ivec4 const& to) {
+	finish();
+	int32_t x0 = std::max(0, to.x), x1 = std::min(int32_t(size.x), to.x + to.z);
+	int32_t y0 = std::max(0, to.y), y1 = std::min(int32_t(size.y), to.y + to.w);
+	for (int32_t y = y0; y < y1; ++y) {
+		// the source pixel under each destination pixel's center:
+		uint32_t fy = uint32_t((float(y - to.y) + 0.5f) * float(from_size.y) / float(to.w));
+		uint32_t const* from_row = from + size_t(std::min(fy, from_size.y - 1)) * from_size.x;
+		uint32_t* row = &pixels[size_t(y) * stride];
+		for (int32_t x = x0; x < x1; ++x) {
+			uint32_t fx = uint32_t((float(x - to.x) + 0.5f) * float(from_size.x) / float(to.z));
+			row[x] = from_row[std::min(fx, from_size.x - 1)];
+		}
+	}
+}
+
+void SoftwareBackend::finish() {
+	if (quads.empty()) {
+		return;
+	}
+	uint32_t tiles_x = (size.x + TILE - 1) / TILE;
+	uint32_t tiles_y = (size.y + TILE - 1) / TILE;
+	bins.resize(tiles_x * tiles_y);
+	for (auto& bin : bins) {
+		bin.clear();
+	}
+	for (uint32_t i = 0; i < quads.size(); ++i) {
+		glm::ivec4 const& b = quads[i].bounds;
+		for (int32_t ty = b.y / TILE; ty <= (b.w - 1) / int32_t(TILE); ++ty) {
+			for (int32_t tx = b.x / TILE; tx <= (b.z - 1) / int32_t(TILE); ++tx) {
+				bins[ty * tiles_x + tx].emplace_back(i);
+			}
+		}
+	}
+
+	// tiles don't share pixels, so threads just take the next one:
+	std::atomic<uint32_t> next(0);
+	auto work = [this, &next]() {
+		for (uint32_t tile = next++; tile < bins.size(); tile = next++) {
+			rasterize(tile);
+		}
+	};
+	std::vector<std::thread> pool;
+	for (uint32_t i = 1; i < std::min< uint32_t >(threads, bins.size()); ++i) {
+		pool.emplace_back(work);
+	}
+	work();
+	for (std::thread& thread : pool) {
+		thread.join();
+	}
+	quads.clear();
+}
+
+void SoftwareBackend::rasterize(uint32_t tile) {
+	uint32_t tiles_x = (size.x + TILE - 1) / TILE;
+	glm::ivec4 area(tile % tiles_x * TILE, tile / tiles_x * TILE, 0, 0);
+	area.z = std::min(area.x + int32_t(TILE), int32_t(size.x));
+	area.w = std::min(area.y + int32_t(TILE), int32_t(size.y));
+
+	for (uint32_t i : bins[tile]) {
+		Quad const& q = quads[i];
+		Texture const* texture = q.texture != -1U ? &textures[q.texture] : nullptr;
+		int32_t x0 = std::max(area.x, q.bounds.x), x1 = std::min(area.z, q.bounds.z);
+		int32_t y0 = std::max(area.y, q.bounds.y), y1 = std::min(area.w, q.bounds.w);
+		for (int32_t y = y0; y < y1; ++y) {
+			if (texture && !texture->field.empty()) {
+				fill_field_span(q, *texture, y, x0, x1, &pixels[size_t(y) * stride]);
+			} else {
+				fill_span(q, texture, y, x0, x1, &pixels[size_t(y) * stride]);
+			}
+		}
+	}
+}
+
+std::vector<uint32_t> SoftwareBackend::read_pixels() const {
+	std::vector<uint32_t> out(size_t(size.x) * size.y);
+	for (uint32_t y = 0; y < size.y; ++y) {
+		std::copy(pixels.begin() + size_t(y) * stride, pixels.begin() + size_t(y) * stride + size.x,
+							out.begin() + size_t(y) * size.x);
+	}
+	return out;
+}
+
+void SoftwareBackend::save_png(std::string const& filename) const {
+	std::vector<uint32_t> out = read_pixels();
+	::save_png(filename, size.x, size.y, &out[0], LowerLeftOrigin);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "render_backend.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * A CPU rasterizer for sprite quads that produces what the sprite program would: the
+ * nearest texel (coordinates clamped to the edge, as the atlas samples) times the
+ * vertex color, blended with GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA into an RGBA8
+ * framebuffer in memory. It needs no GL context.
+ *
+ * draw() transforms quads to pixel space and records them. finish() bins them into
+ * TILE x TILE pixel tiles and rasterizes the tiles on several threads. Within a tile,
+ * quads are drawn in submission order, so blending comes out as if they were drawn
+ * one by one. Spans are filled four pixels at a time with SSE2, one at a time without.
+ * Corners snap to 1/256 pixel and pixel centers on an edge go to the quad on its right
+ * or above, as in GL, so quads sharing an edge cover each pixel once.
+ * Quads may be rotated but must be parallelograms (everything SpriteBatch and DrawList
+ * write is), and take the color of their first vertex.
+ *
+ * Distance field textures are drawn as text.frag draws them instead: trilinearly
+ * sampled from box-filtered mipmaps, the vertex color where the field is inside and the
+ * texture's background elsewhere, smoothed over about a pixel. Those spans are scalar.
+ */
+
+struct SoftwareBackend : RenderBackend {
+	// 'threads' 0 means one per hardware thread:
+	SoftwareBackend(glm::uvec2 const& size, uint32_t threads = 0);
+
+	// 'layers' images of 'size' pixels, rows bottom first (as load_png(..., LowerLeftOrigin) gives them).
+	// Returns the handle to draw with:
+	GLuint add_texture(glm::uvec2 const& size, uint32_t layers, uint32_t const* pixels);
+	// a one-layer distance field (in alpha, 0.5 on outlines), drawn over 'background':
+	GLuint add_distance_field(glm::uvec2 const& size, uint32_t const* pixels, glm::u8vec4 const& background);
+
+	// set every pixel, after rasterizing what was drawn before:
+	void clear(glm::u8vec4 const& color);
+	void draw(SpriteBatch const& batch, GLint first, GLsizei count, GLuint texture) override;
+	// copy a 'from_size' image (rows bottom first) over 'to', (x, y, width, height) in pixels, nearest-neighbour
+	// as RenderTarget::present blits, after rasterizing what was drawn before:
+	void blit(glm::uvec2 const& from_size, uint32_t const* from, glm::ivec4 const& to);
+	// rasterize everything drawn since the last finish():
+	void finish();
+
+	// the framebuffer as of the last finish(), rows bottom first:
+	std::vector<uint32_t> read_pixels() const;
+	void save_png(std::string const& filename) const;
+
+	// takes vertex positions to clip space, applied by draw(); only x and y are used, and w must be 1:
+	glm::mat4 mvp = glm::mat4(1.0f);
+	// where clip space lands, (x, y, width, height) in pixels; quads are clipped to it. The whole framebuffer to start:
+	glm::ivec4 viewport;
+
+	static const uint32_t TILE = 64; // pixels; a multiple of 4, so SSE2 spans never cross tiles
+	glm::uvec2 size;
+	uint32_t threads;
+
+	struct Texture {
+		glm::uvec2 size;
+		uint32_t layers;
+		std::vector<uint32_t> texels;
+		// distance fields only: the alpha of each mipmap level, largest first, and the color outside the outlines:
+		std::vector<std::vector<float>> field;
+		std::vector<glm::uvec2> field_sizes;
+		glm::u8vec4 background;
+	};
+	// a quad in pixel space; with (x, y) a pixel center, each plane gives p.x * x + p.y * y + p.z:
+	struct Quad {
+		glm::vec3 s, t; // coverage: 0 <= s < 1 and 0 <= t < 1
+		glm::vec3 u, v; // texel coordinates
+		glm::ivec4 bounds; // pixels [x, z) by [y, w)
+		uint32_t texture;  // index into 'textures', or -1U for none (draws black)
+		uint32_t layer;
+		glm::u8vec4 color;
+	};
+
+private:
+	void rasterize(uint32_t tile);
+
+	uint32_t stride; // framebuffer row length, 'size.x' rounded up to a multiple of 4
+	std::vector<uint32_t> pixels;
+	std::vector<Texture> textures;
+	std::vector<Quad> quads;
+	std::vector<std::vector<uint32_t>> bins; // indices into 'quads', per tile
+};
@@ -0,0 +1,101 @@
+#include "software_renderer.hpp"
+#include "scene_sprites.hpp"
+#include "render_target.hpp"
+#include "text.hpp"
+#include "load_save_png.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+SoftwareRenderer::SoftwareRenderer(Config const& config, Level const& level_, glm::uvec2 const& window_size,
+																	 uint32_t threads)
+		: level(level_), scene(config.native_size, threads), window(window_size, threads),
+			world(attributes, GL_STATIC_DRAW), dynamic(attributes, GL_STREAM_DRAW), hud(attributes, GL_STATIC_DRAW),
+			hint(attributes, GL_STATIC_DRAW) {
+	if (config.native_size == glm::uvec2(0)) {
+		throw std::runtime_error("Software rendering needs a native size.");
+	}
+
+	// the pages as layers of one texture, as Atlas keeps them:
+	const glm::uvec2 page_size = glm::uvec2(320, 240);
+	std::vector< uint32_t > pages;
+	for (uint32_t p = 0; p < config.atlas_pages.size(); ++p) {
+		std::string const& page = config.atlas_pages[p];
+		glm::uvec2 size;
+		std::vector< uint32_t > data;
+		if (!load_png(page + ".png", &size.x, &size.y, &data, LowerLeftOrigin) || size != page_size
+				|| !load_sprite_info(page + ".file", p)) {
+			throw std::runtime_error("Failed to load texture.");
+		}
+		pages.insert(pages.end(), data.begin(), data.end());
+	}
+	scene_atlas = scene.add_texture(page_size, uint32_t(config.atlas_pages.size()), &pages[0]);
+	window_atlas = window.add_texture(page_size, uint32_t(config.atlas_pages.size()), &pages[0]);
+
+	glm::uvec2 font_size;
+	std::vector< uint32_t > font;
+	if (!load_sdf_glyphs(config.hint_font, &hintFont)
+			|| !load_png(config.hint_font + ".png", &font_size.x, &font_size.y, &font, LowerLeftOrigin)) {
+		throw std::runtime_error("Failed to load hint font.");
+	}
+	hintFont.tex = window.add_distance_field(font_size, &font[0], HINT_BACKGROUND);
+
+	worldList.barriers.set(LAYER_PROPS);
+}
+
+void SoftwareRenderer::draw(Game const& game) {
+	// region images load as RegionStreamer loads them, falling back to the region's atlas sprite:
+	auto found = regions.find(game.currentMap);
+	if (found == regions.end()) {
+		std::string image = level.string(level.regions[game.currentMap].image);
+		glm::uvec2 size;
+		std::vector< uint32_t > data;
+		GLuint tex = 0;
+		if (!image.empty()) {
+			if (load_png("assets/" + image, &size.x, &size.y, &data, LowerLeftOrigin)) {
+				tex = scene.add_texture(size, 1, &data[0]);
+			} else {
+				std::cerr << "Failed to load region image '" << image << "', using its atlas sprite." << std::endl;
+			}
+		}
+		found = regions.insert(std::make_pair(game.currentMap, tex)).first;
+	}
+
+	worldList.clear();
+	world.clear();
+	hud.clear();
+	submit_static(game, scene_atlas, found->second, &worldList, &hud);
+	glm::vec2 regionRadius = level.regions[game.currentMap].radius;
+	worldList.emit(-regionRadius, regionRadius, &world);
+
+	dynamicList.clear();
+	dynamic.clear();
+	submit_actors(game, scene_atlas, &dynamicList);
+	dynamicList.emit(game.camera.at - game.camera.radius, game.camera.at + game.camera.radius, &dynamic);
+
+	glm::mat4 mvp = camera_mvp(game);
+	scene.mvp = mvp;
+	scene.clear(glm::u8vec4(0x80, 0x80, 0x80, 0x00));
+	worldList.draw(world, LAYER_BACKGROUND, LAYER_BACKGROUND, &scene);
+	worldList.draw(world, LAYER_PROPS, 0xff, &scene);
+	dynamicList.draw(dynamic, 0, 0xff, &scene);
+	scene.finish();
+
+	// black borders around the blown up world, then the interface over it:
+	glm::ivec4 viewport = present_viewport(scene.size, window.size);
+	window.viewport = glm::ivec4(0, 0, window.size.x, window.size.y);
+	window.clear(glm::u8vec4(0x00, 0x00, 0x00, 0xff));
+	std::vector< uint32_t > pixels = scene.read_pixels();
+	window.blit(scene.size, &pixels[0], viewport);
+
+	mvp[3] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	window.mvp = mvp;
+	window.viewport = viewport;
+	window.draw(hud, 0, GLsizei(hud.verts.size()), window_atlas);
+	if (hint_shown(game)) {
+		hint.clear();
+		write_text(game.hint, HINT_AT, 1.0f, &hintFont, &hint);
+		window.draw(hint, 0, GLsizei(hint.verts.size()), hintFont.tex);
+	}
+	window.finish();
+}
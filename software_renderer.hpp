@@ -0,0 +1,48 @@
+#pragma once
+
+#include "config.hpp"
+#include "level.hpp"
+#include "game.hpp"
+#include "sprite_batch.hpp"
+#include "draw_list.hpp"
+#include "sdf_font.hpp"
+#include "software_raster.hpp"
+
+#include <glm/glm.hpp>
+
+#include <map>
+#include <vector>
+
+/*
+ * Draws a Game as Renderer does, but on the CPU with SoftwareBackend, so frames can be
+ * checked on machines without a GPU or display (see golden.cpp --software). The world
+ * is drawn at the native size and integer scaled into the window, then the interface
+ * and the hint are drawn over it. Region images are loaded from 'assets' the first time
+ * a region is drawn. Tile layers and the performance overlay are not drawn, and the
+ * world is never drawn at a share of the window (Config::native_size must be set).
+ */
+
+struct SoftwareRenderer {
+	// throws if an asset fails to load; 'threads' as for SoftwareBackend:
+	SoftwareRenderer(Config const& config, Level const& level, glm::uvec2 const& window_size, uint32_t threads = 0);
+
+	// draw a frame into 'window':
+	void draw(Game const& game);
+
+	Level const& level;
+	// the world at the native size, and the window it is blown up into; each has its own copy of the atlas:
+	SoftwareBackend scene;
+	SoftwareBackend window;
+	GLuint scene_atlas = 0;
+	GLuint window_atlas = 0;
+	SdfFont hintFont; // 'tex' is a 'window' texture
+	std::map< uint32_t, GLuint > regions; // region image textures in 'scene' by region, 0 for none
+
+	VertexAttributes attributes;
+	DrawList worldList;
+	DrawList dynamicList;
+	SpriteBatch world;
+	SpriteBatch dynamic;
+	SpriteBatch hud;
+	SpriteBatch hint;
+};
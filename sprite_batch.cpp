@@ -0,0 +1,49 @@
+#include "sprite_batch.hpp"
+#include "quads.hpp"
+#include "render_state.hpp"
+
+#include <cmath>
+
+SpriteBatch::SpriteBatch(VertexAttributes const& attributes_, GLenum usage_) : attributes(attributes_), usage(usage_) {}
+
+void SpriteBatch::draw_sprite(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at, glm::u8vec4 tint,
+															float angle) {
+	glm::vec2 min_uv = sprite.min_uv;
+	glm::vec2 max_uv = sprite.max_uv;
+	float layer = float(sprite.layer);
+	glm::vec2 right = glm::vec2(std::cos(angle), std::sin(angle));
+	glm::vec2 up = glm::vec2(-right.y, right.x);
+
+	verts.emplace_back(at + right * -rad.x + up * -rad.y, glm::vec3(min_uv.x, min_uv.y, layer), tint);
+	verts.emplace_back(at + right * -rad.x + up * rad.y, glm::vec3(min_uv.x, max_uv.y, layer), tint);
+	verts.emplace_back(at + right * rad.x + up * -rad.y, glm::vec3(max_uv.x, min_uv.y, layer), tint);
+	verts.emplace_back(at + right * rad.x + up * rad.y, glm::vec3(max_uv.x, max_uv.y, layer), tint);
+}
+
+void SpriteBatch::draw_word(std::string const& word, glm::vec2 const& at) {
+	for (unsigned i = 0; i < word.length(); i++) {
+		draw_sprite(glyph_sprite(word[i]), glm::vec2(0.5f, 0.6f), glm::vec2(at.x + float(i), at.y));
+	}
+}
+
+void SpriteBatch::upload() {
+	if (!vao) {
+		glGenBuffers(1, &buffer);
+		glGenVertexArrays(1, &vao);
+		render_state.bind_vertex_array(vao);
+		render_state.bind_array_buffer(buffer);
+		bind_vertex_attributes(attributes);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quad_index_buffer());
+	}
+	render_state.bind_array_buffer(buffer);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts.size(), verts.empty() ? nullptr : &verts[0], usage);
+	uploaded_verts = verts.size();
+}
+
+void SpriteBatch::draw(GLint first, GLsizei count) const {
+	if (count <= 0) {
+		return;
+	}
+	render_state.bind_vertex_array(vao);
+	draw_quads(first, count);
+}
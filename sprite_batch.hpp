@@ -0,0 +1,41 @@
+#pragma once
+
+#include "sprites.hpp"
+#include "vertex.hpp"
+
+#include <string>
+#include <vector>
+
+/*
+ * A list of sprite quads with its own vertex buffer. Static batches are rebuilt and
+ * uploaded only when something in them changes; streamed batches every frame.
+ * GL objects are created by the first upload(), so batches can be built (and drawn by
+ * a RenderBackend that reads 'verts') without a GL context.
+ */
+
+struct SpriteBatch {
+	// 'usage' is the glBufferData hint (GL_STATIC_DRAW or GL_STREAM_DRAW):
+	SpriteBatch(VertexAttributes const& attributes, GLenum usage);
+
+	std::vector<Vertex> verts;
+
+	void clear() { verts.clear(); }
+
+	// append a quad (four vertices, see quads.hpp):
+	void draw_sprite(SpriteData const& sprite, glm::vec2 const& rad, glm::vec2 const& at,
+									 glm::u8vec4 tint = glm::u8vec4(0xff, 0xff, 0xff, 0xff), float angle = 0.0f);
+	// append one letter sprite per character:
+	void draw_word(std::string const& word, glm::vec2 const& at);
+
+	// copy 'verts' to the GL buffer:
+	void upload();
+	// draw 'count' uploaded vertices starting at 'first' with the bound program and texture:
+	void draw(GLint first, GLsizei count) const;
+	void draw() const { draw(0, uploaded_verts); }
+
+	VertexAttributes attributes;
+	GLuint buffer = 0;
+	GLuint vao = 0;
+	GLenum usage;
+	GLsizei uploaded_verts = 0;
+};
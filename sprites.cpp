@@ -0,0 +1,50 @@
+#include "sprites.hpp"
+
+#include <fstream>
+#include <iostream>
+
+std::vector<SpriteData> sprites;
+
+// Code inspired from
+// https://github.com/ixchow/15-466-f17-base2/blob/bbda559b9156f5b539f6fab33f45fa684325d6c2/Meshes.cpp
+bool load_sprite_info(std::string const& filename, uint32_t layer) {
+	std::ifstream file(filename, std::ios::binary);
+
+	{
+		struct Header {
+			uint32_t size = 0;
+			uint32_t padding;
+		} header;
+		static_assert(sizeof(Header) == 8, "Header is packed");
+
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+			std::cerr << "Failed to read header" << std::endl;
+			return false;
+		}
+
+		// records on disk don't store the page:
+		struct Record {
+			glm::vec2 min_uv;
+			glm::vec2 max_uv;
+			glm::vec2 center;
+		};
+		static_assert(sizeof(Record) == 6 * 4, "Record is packed");
+
+		std::vector<Record> records(header.size / sizeof(Record));
+		if (!records.empty() && !file.read(reinterpret_cast<char*>(&records[0]), records.size() * sizeof(Record))) {
+			std::cerr << "Reading sprite info failed" << std::endl;
+			return false;
+		}
+
+		sprites.reserve(sprites.size() + records.size());
+		for (Record const& record : records) {
+			SpriteData sprite;
+			sprite.min_uv = record.min_uv;
+			sprite.max_uv = record.max_uv;
+			sprite.center = record.center;
+			sprite.layer = layer;
+			sprites.emplace_back(sprite);
+		}
+	}
+	return true;
+}
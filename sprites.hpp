@@ -0,0 +1,125 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+struct SpriteData {
+	glm::vec2 min_uv = glm::vec2(0.0f);
+	glm::vec2 max_uv = glm::vec2(0.5f);
+	glm::vec2 center = glm::vec2(2.0f);
+	uint32_t layer = 0; // atlas page
+};
+
+// loaded from the atlas .file of each page in turn, indexed by SpriteInfo:
+extern std::vector<SpriteData> sprites;
+
+enum SpriteInfo {
+	A,
+	B,
+	C,
+	D,
+	E,
+	F,
+	G,
+	H,
+	I,
+	J,
+	K,
+	L,
+	M,
+	N,
+	O,
+	P,
+	Q,
+	R,
+	S,
+	T,
+	U,
+	V,
+	W,
+	X,
+	Y,
+	Z,
+	SPACE,
+	MAP_RIGHT,
+	MAP_LEFT,
+	MAP_MIDDLE,
+	PLAYER,
+	PLAYER_HOLDING,
+	CRYSTAL,
+	APPLE,
+	BOARDS,
+	BRIDGE,
+	PICKAXE,
+	LONG_KNIFE,
+	KEY,
+	PICKAXE_HEAD,
+	ROPE,
+	KNIFE,
+	COIN,
+	HOLE,
+	STICK,
+	ROD,
+	ROCK,
+	DOOR,
+	SCALE,
+	SCALE_UNBALANCED,
+	// assets/glyphs page:
+	DIGIT_0,
+	DIGIT_1,
+	DIGIT_2,
+	DIGIT_3,
+	DIGIT_4,
+	DIGIT_5,
+	DIGIT_6,
+	DIGIT_7,
+	DIGIT_8,
+	DIGIT_9,
+	PERIOD,
+	COMMA,
+	EXCLAMATION,
+	QUESTION,
+	APOSTROPHE,
+	DASH,
+	COLON,
+	SOLID, // opaque white, tinted for panels and bars
+	SPRITE_COUNT, // not a sprite: the number of names above
+};
+
+// appends the sprites of one atlas page:
+bool load_sprite_info(std::string const& filename, uint32_t layer);
+
+inline SpriteData load_sprite(SpriteInfo name) {
+	return sprites[name];
+}
+
+// glyph sprite for a character; lower case draws as upper case and anything without a glyph as a space:
+constexpr SpriteInfo glyph_for(unsigned char c) {
+	return c >= 'A' && c <= 'Z' ? SpriteInfo(A + (c - 'A'))
+			: c >= 'a' && c <= 'z' ? SpriteInfo(A + (c - 'a'))
+			: c >= '0' && c <= '9' ? SpriteInfo(DIGIT_0 + (c - '0'))
+			: c == '.' ? PERIOD
+			: c == ',' ? COMMA
+			: c == '!' ? EXCLAMATION
+			: c == '?' ? QUESTION
+			: c == '\'' ? APOSTROPHE
+			: c == '-' ? DASH
+			: c == ':' ? COLON
+			: SPACE;
+}
+
+// glyph_for() of every byte, evaluated at compile time:
+#define GLYPHS_4(c) glyph_for(c), glyph_for(c + 1), glyph_for(c + 2), glyph_for(c + 3)
+#define GLYPHS_16(c) GLYPHS_4(c), GLYPHS_4(c + 4), GLYPHS_4(c + 8), GLYPHS_4(c + 12)
+#define GLYPHS_64(c) GLYPHS_16(c), GLYPHS_16(c + 16), GLYPHS_16(c + 32), GLYPHS_16(c + 48)
+constexpr SpriteInfo GLYPHS[256] = {GLYPHS_64(0), GLYPHS_64(64), GLYPHS_64(128), GLYPHS_64(192)};
+#undef GLYPHS_64
+#undef GLYPHS_16
+#undef GLYPHS_4
+static_assert(GLYPHS['Q'] == Q && GLYPHS['q'] == Q && GLYPHS['7'] == DIGIT_7 && GLYPHS[0xff] == SPACE, "glyph table");
+
+inline SpriteData glyph_sprite(char c) {
+	return load_sprite(GLYPHS[(unsigned char)c]);
+}
@@ -0,0 +1,27 @@
+#include "text.hpp"
+
+void write_text(std::string const& text, glm::vec2 const& at, float scale, SdfFont const* font, SpriteBatch* batch) {
+	for (size_t i = 0; i < text.size(); ++i) {
+		SpriteData const& glyph = font ? font->glyph(text[i]) : glyph_sprite(text[i]);
+		batch->draw_sprite(glyph, glm::vec2(0.5f, 0.6f) * scale, at + glm::vec2(float(i) * scale, 0.0f));
+	}
+}
+
+TextRun::TextRun(VertexAttributes const& attributes, SdfFont const* font_)
+		: batch(attributes, GL_STATIC_DRAW), font(font_) {
+}
+
+void TextRun::set(std::string const& text_, glm::vec2 const& at_, float scale_) {
+	if (built && text_ == text && at_ == at && scale_ == scale) {
+		return;
+	}
+	text = text_;
+	at = at_;
+	scale = scale_;
+	built = true;
+	++layouts;
+
+	batch.clear();
+	write_text(text, at, scale, font, &batch);
+	batch.upload();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "sprite_batch.hpp"
+#include "sdf_font.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+
+/*
+ * A line of glyph sprites laid out once into its own vertex buffer. set() is cheap to
+ * call every frame: glyphs are only looked up, written and uploaded again when the text
+ * or its position differs from what the buffer already holds.
+ * Runs given an SdfFont stay sharp at any scale (drawn with the distance field program
+ * in main.cpp); otherwise they use the atlas glyph sprites. write_text() lays out a line
+ * without the buffer, for batches that are never uploaded.
+ */
+
+// append one glyph sprite per character of 'text' to 'batch', laid out as TextRun::set() describes
+// ('font' null for the atlas glyph sprites):
+void write_text(std::string const& text, glm::vec2 const& at, float scale, SdfFont const* font, SpriteBatch* batch);
+
+struct TextRun {
+	TextRun(VertexAttributes const& attributes, SdfFont const* font = nullptr);
+
+	// lay out 'text' with its first glyph centered on 'at', unless that is already the case.
+	// Glyphs are 'scale' units apart and 1.2 * 'scale' tall:
+	void set(std::string const& text, glm::vec2 const& at, float scale = 1.0f);
+	// draw with the bound program and texture (the atlas, or the font's):
+	void draw() const { batch.draw(); }
+
+	uint32_t layouts = 0; // times set() actually rebuilt the run
+
+private:
+	SpriteBatch batch;
+	SdfFont const* font;
+	std::string text;
+	glm::vec2 at = glm::vec2(0.0f);
+	float scale = 1.0f;
+	bool built = false;
+};
@@ -0,0 +1,107 @@
+#include "tilemap.hpp"
+#include "quads.hpp"
+#include "render_state.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+uint32_t Tilemap::draw(glm::vec2 const &min, glm::vec2 const &max, VertexAttributes const &attributes, CameraBlock *camera) {
+	if (tiles.empty()) {
+		return 0;
+	}
+	if (chunks.empty()) {
+		chunk_count = (size + glm::uvec2(CHUNK_SIZE - 1)) / CHUNK_SIZE;
+		chunks.resize(chunk_count.x * chunk_count.y);
+	}
+
+	// chunk index range overlapping the view, computed directly so nothing outside it is visited:
+	glm::vec2 origin = -glm::vec2(size) * tile_size * 0.5f;
+	float chunk_extent = CHUNK_SIZE * tile_size;
+	glm::vec2 lo = glm::floor((min - origin) / chunk_extent);
+	glm::vec2 hi = glm::floor((max - origin) / chunk_extent);
+	int32_t x0 = std::max(int32_t(lo.x), 0);
+	int32_t y0 = std::max(int32_t(lo.y), 0);
+	int32_t x1 = std::min(int32_t(hi.x), int32_t(chunk_count.x) - 1);
+	int32_t y1 = std::min(int32_t(hi.y), int32_t(chunk_count.y) - 1);
+
+	uint32_t drawn = 0;
+	for (int32_t cy = y0; cy <= y1; ++cy) {
+		for (int32_t cx = x0; cx <= x1; ++cx) {
+			Chunk &chunk = chunks[cy * chunk_count.x + cx];
+			if (!chunk.vao) {
+				build(cx, cy, attributes);
+			}
+			if (chunk.count) {
+				glm::vec2 corner = origin + glm::vec2(cx, cy) * chunk_extent;
+				glm::mat4 mvp = camera->mvp[CameraBlock::WORLD];
+				mvp[3] = mvp[3] + mvp[0] * corner.x + mvp[1] * corner.y;
+				camera->set(CameraBlock::CHUNK, mvp);
+				camera->use(CameraBlock::CHUNK);
+				render_state.bind_vertex_array(chunk.vao);
+				draw_quads(0, chunk.count);
+				++drawn;
+			}
+		}
+	}
+	camera->use(CameraBlock::WORLD);
+	return drawn;
+}
+
+void Tilemap::build(uint32_t cx, uint32_t cy, VertexAttributes const &attributes) {
+	glm::vec2 uv_size = glm::vec2(1.0f) / glm::vec2(tileset_grid);
+	glm::u8vec4 white(0xff, 0xff, 0xff, 0xff);
+
+	std::vector< Vertex > verts;
+	uint32_t x_end = std::min((cx + 1) * CHUNK_SIZE, size.x);
+	uint32_t y_end = std::min((cy + 1) * CHUNK_SIZE, size.y);
+	for (uint32_t y = cy * CHUNK_SIZE; y < y_end; ++y) {
+		for (uint32_t x = cx * CHUNK_SIZE; x < x_end; ++x) {
+			uint16_t tile = tiles[y * size.x + x];
+			if (tile == EMPTY_TILE) {
+				continue;
+			}
+			// tileset rows count down from the top of the image:
+			glm::vec2 min_uv = glm::vec2(tile % tileset_grid.x, tileset_grid.y - 1 - tile / tileset_grid.x) * uv_size;
+			glm::vec2 max_uv = min_uv + uv_size;
+			// relative to the chunk's corner:
+			glm::vec2 min = glm::vec2(x - cx * CHUNK_SIZE, y - cy * CHUNK_SIZE) * tile_size;
+			glm::vec2 max = min + glm::vec2(tile_size);
+
+			// same four-vertex layout as draw_sprite:
+			verts.emplace_back(min, glm::vec3(min_uv, 0.0f), white);
+			verts.emplace_back(glm::vec2(min.x, max.y), glm::vec3(min_uv.x, max_uv.y, 0.0f), white);
+			verts.emplace_back(glm::vec2(max.x, min.y), glm::vec3(max_uv.x, min_uv.y, 0.0f), white);
+			verts.emplace_back(max, glm::vec3(max_uv, 0.0f), white);
+		}
+	}
+
+	Chunk &chunk = chunks[cy * chunk_count.x + cx];
+	glGenVertexArrays(1, &chunk.vao);
+	chunk.count = verts.size();
+	if (!verts.empty()) {
+		glGenBuffers(1, &chunk.buffer);
+		render_state.bind_array_buffer(chunk.buffer);
+		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts.size(), &verts[0], GL_STATIC_DRAW);
+		render_state.bind_vertex_array(chunk.vao);
+		bind_vertex_attributes(attributes);
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quad_index_buffer());
+		chunk_bytes += sizeof(Vertex) * verts.size();
+	}
+}
+
+size_t Tilemap::bytes() const {
+	return tiles.size() * sizeof(uint16_t) + chunks.size() * sizeof(Chunk) + chunk_bytes;
+}
+
+void Tilemap::clear_buffers() {
+	for (Chunk &chunk : chunks) {
+		if (chunk.buffer) {
+			render_state.delete_buffer(chunk.buffer);
+		}
+		if (chunk.vao) {
+			render_state.delete_vertex_array(chunk.vao);
+		}
+	}
+	chunks.clear();
+	chunk_bytes = 0;
+}
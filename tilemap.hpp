@@ -0,0 +1,52 @@
+#pragma once
+
+#include "vertex.hpp"
+#include "render_state.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+#include <stdint.h>
+
+/*
+ * A grid of tiles centered on the region origin (row 0 at the bottom), drawn from a
+ * tileset texture cut into a regular grid (tile 0 at its top left). Tiles are grouped
+ * into CHUNK_SIZE x CHUNK_SIZE chunks, each with its own static vertex buffer built the
+ * first time the chunk is visible. draw() only visits chunks overlapping the view, so
+ * the cost per frame depends on the view size rather than on the size of the map.
+ */
+
+struct Tilemap {
+	static const uint32_t CHUNK_SIZE = 32;
+	static const uint16_t EMPTY_TILE = 0xffff;
+
+	glm::uvec2 size = glm::uvec2(0, 0); // in tiles
+	float tile_size = 1.0f; // world units
+	glm::uvec2 tileset_grid = glm::uvec2(1, 1); // tiles across and down the tileset
+	std::vector< uint16_t > tiles; // size.x * size.y, row-major from the bottom row
+
+	bool empty() const { return tiles.empty(); }
+
+	// draws the chunks overlapping [min, max] (world units) with the currently bound program and texture.
+	// Chunk vertices are relative to the chunk's corner, so each is drawn through the camera's CHUNK view,
+	// set from its WORLD view; WORLD is in use again afterwards. Returns the number of chunks drawn:
+	uint32_t draw(glm::vec2 const &min, glm::vec2 const &max, VertexAttributes const &attributes, CameraBlock *camera);
+
+	// bytes of tile data plus chunk buffers built so far:
+	size_t bytes() const;
+
+	// chunk buffers are not freed by the destructor (it may run without a GL context); call this instead:
+	void clear_buffers();
+
+private:
+	struct Chunk {
+		GLuint buffer = 0;
+		GLuint vao = 0;
+		GLsizei count = 0;
+	};
+	std::vector< Chunk > chunks;
+	glm::uvec2 chunk_count = glm::uvec2(0, 0);
+	size_t chunk_bytes = 0;
+
+	void build(uint32_t cx, uint32_t cy, VertexAttributes const &attributes);
+};
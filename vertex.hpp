@@ -0,0 +1,119 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cassert>
+
+// Vertex layout of the sprite shader, shared by every buffer drawn with it.
+// Building with COMPACT_VERTICES defined (jam -sCOMPACT_VERTICES=1) selects a 12 byte layout:
+//  16-bit fixed point positions, 16-bit normalized UVs, RGBA4444 color and a 16-bit layer.
+// Either way vertices are constructed from the same float values, so only this file,
+// shaders (through VERTEX_SHADER_INPUTS) and write_quads (which stores both layouts with
+// SSE2, see quad_kernel.cpp) see the difference.
+
+#ifdef COMPACT_VERTICES
+
+// world units are stored in 1/POSITION_SCALE steps, relative to the origin of whatever space the
+// vertices are in (the region for sprites, the chunk's corner for tiles), so positions must stay
+// within +/-POSITION_LIMIT. load_level rejects levels that would go past it; the constructor
+// asserts it as well, as int16 would otherwise wrap:
+const float POSITION_SCALE = 64.0f;
+const float POSITION_LIMIT = 32767.0f / POSITION_SCALE;
+
+struct Vertex {
+	Vertex() = default;
+	Vertex(glm::vec2 const& Position_, glm::vec3 const& TexCoord_, glm::u8vec4 const& Color_)
+			: Position((assert(glm::abs(Position_.x) <= POSITION_LIMIT && glm::abs(Position_.y) <= POSITION_LIMIT
+												 && "compact vertex position out of range"),
+									glm::round(Position_ * POSITION_SCALE))),
+				TexCoord(glm::round(glm::clamp(glm::vec2(TexCoord_.x, TexCoord_.y), 0.0f, 1.0f) * 65535.0f)),
+				Color(uint16_t((Color_.x >> 4) << 12 | (Color_.y >> 4) << 8 | (Color_.z >> 4) << 4 | Color_.w >> 4),
+							uint16_t(TexCoord_.z)) {}
+	glm::i16vec2 Position;
+	glm::u16vec2 TexCoord;
+	glm::u16vec2 Color; // x is RGBA4444, y is the texture array layer
+};
+static_assert(sizeof(Vertex) == 12, "Vertex is nicely packed.");
+
+// GLSL inputs plus accessors that return what the float layout would have:
+#define VERTEX_SHADER_INPUTS                                                                                 \
+	"in vec2 Position;\n"                                                                                      \
+	"in vec2 TexCoord;\n"                                                                                      \
+	"in uvec2 Color;\n"                                                                                        \
+	"vec4 vertex_position() { return vec4(Position / 64.0, 0.0, 1.0); }\n" /* POSITION_SCALE */               \
+	"vec3 vertex_texcoord() { return vec3(TexCoord, float(Color.y)); }\n"                                      \
+	"vec4 vertex_color() { return vec4(uvec4(Color.x) >> uvec4(12u, 8u, 4u, 0u) & uvec4(15u)) / 15.0; }\n"
+
+#else
+
+struct Vertex {
+	Vertex() = default;
+	Vertex(glm::vec2 const& Position_, glm::vec3 const& TexCoord_, glm::u8vec4 const& Color_)
+			: Position(Position_), TexCoord(TexCoord_), Color(Color_) {}
+	glm::vec2 Position;
+	glm::vec3 TexCoord; // z is the texture array layer
+	glm::u8vec4 Color;
+};
+static_assert(sizeof(Vertex) == 24, "Vertex is nicely packed.");
+
+#define VERTEX_SHADER_INPUTS                              \
+	"in vec4 Position;\n"                                   \
+	"in vec3 TexCoord;\n"                                   \
+	"in vec4 Color;\n"                                      \
+	"vec4 vertex_position() { return Position; }\n"         \
+	"vec3 vertex_texcoord() { return TexCoord; }\n"         \
+	"vec4 vertex_color() { return Color; }\n"
+
+#endif
+
+// the values a vertex was constructed from (up to the layout's precision), as the shader accessors
+// see them, for code that reads vertices on the CPU:
+inline glm::vec2 vertex_position(Vertex const& v) {
+#ifdef COMPACT_VERTICES
+	return glm::vec2(v.Position) / POSITION_SCALE;
+#else
+	return v.Position;
+#endif
+}
+inline glm::vec3 vertex_texcoord(Vertex const& v) {
+#ifdef COMPACT_VERTICES
+	return glm::vec3(glm::vec2(v.TexCoord) / 65535.0f, float(v.Color.y));
+#else
+	return v.TexCoord;
+#endif
+}
+inline glm::u8vec4 vertex_color(Vertex const& v) {
+#ifdef COMPACT_VERTICES
+	// 4-bit channels widen exactly by repeating the nibble (x * 17):
+	return glm::u8vec4((v.Color.x >> 12 & 15) * 17, (v.Color.x >> 8 & 15) * 17, (v.Color.x >> 4 & 15) * 17,
+										 (v.Color.x & 15) * 17);
+#else
+	return v.Color;
+#endif
+}
+
+// attribute locations in the sprite shader:
+struct VertexAttributes {
+	GLuint Position = 0;
+	GLuint TexCoord = 0;
+	GLuint Color = 0;
+};
+
+// point the attributes at the buffer bound to GL_ARRAY_BUFFER (records into the bound vao):
+inline void bind_vertex_attributes(VertexAttributes const& attributes) {
+#ifdef COMPACT_VERTICES
+	glVertexAttribPointer(attributes.Position, 2, GL_SHORT, GL_FALSE, sizeof(Vertex), (GLbyte*)0);
+	glVertexAttribPointer(attributes.TexCoord, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Vertex), (GLbyte*)0 + 4);
+	glVertexAttribIPointer(attributes.Color, 2, GL_UNSIGNED_SHORT, sizeof(Vertex), (GLbyte*)0 + 8);
+#else
+	glVertexAttribPointer(attributes.Position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte*)0);
+	glVertexAttribPointer(attributes.TexCoord, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte*)0 + sizeof(glm::vec2));
+	glVertexAttribPointer(attributes.Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex),
+												(GLbyte*)0 + sizeof(glm::vec2) + sizeof(glm::vec3));
+#endif
+	glEnableVertexAttribArray(attributes.Position);
+	glEnableVertexAttribArray(attributes.TexCoord);
+	glEnableVertexAttribArray(attributes.Color);
+}
@@ -0,0 +1,471 @@
+#include "world_batch.hpp"
+#include "game.hpp"
+#include "sprites.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// the few vector operations the movement kernel needs, for each instruction set (as in quad_kernel.cpp).
+// Negation flips the sign bit, as unary minus does, so results match Game's bit for bit:
+#if defined(__AVX2__)
+struct Mask {
+	__m256 v;
+	Mask(__m256 v_) : v(v_) {}
+	// lanes whose 'bits' have any of 'bit':
+	static Mask bits(uint32_t const* p, uint32_t bit) {
+		__m256i b = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast< __m256i const* >(p)), _mm256_set1_epi32(bit));
+		return _mm256_andnot_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(b, _mm256_setzero_si256())),
+														_mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+	}
+	Mask operator&(Mask const& o) const { return _mm256_and_ps(v, o.v); }
+	Mask operator|(Mask const& o) const { return _mm256_or_ps(v, o.v); }
+	Mask and_not(Mask const& o) const { return _mm256_andnot_ps(o.v, v); }
+	uint32_t lanes() const { return _mm256_movemask_ps(v); }
+};
+struct Lanes {
+	static const size_t WIDTH = 8;
+	__m256 v;
+	Lanes(__m256 v_) : v(v_) {}
+	static Lanes load(float const* p) { return _mm256_loadu_ps(p); }
+	static Lanes splat(float f) { return _mm256_set1_ps(f); }
+	static Lanes select(Mask const& m, Lanes const& a, Lanes const& b) { return _mm256_blendv_ps(b.v, a.v, m.v); }
+	void store(float* p) const { _mm256_storeu_ps(p, v); }
+	Lanes operator+(Lanes const& o) const { return _mm256_add_ps(v, o.v); }
+	Lanes operator-(Lanes const& o) const { return _mm256_sub_ps(v, o.v); }
+	Lanes negated() const { return _mm256_xor_ps(v, _mm256_set1_ps(-0.0f)); }
+	Mask operator<(Lanes const& o) const { return _mm256_cmp_ps(v, o.v, _CMP_LT_OQ); }
+	Mask operator>(Lanes const& o) const { return _mm256_cmp_ps(v, o.v, _CMP_GT_OQ); }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+struct Mask {
+	__m128 v;
+	Mask(__m128 v_) : v(v_) {}
+	static Mask bits(uint32_t const* p, uint32_t bit) {
+		__m128i b = _mm_and_si128(_mm_loadu_si128(reinterpret_cast< __m128i const* >(p)), _mm_set1_epi32(bit));
+		return _mm_andnot_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(b, _mm_setzero_si128())),
+												 _mm_castsi128_ps(_mm_set1_epi32(-1)));
+	}
+	Mask operator&(Mask const& o) const { return _mm_and_ps(v, o.v); }
+	Mask operator|(Mask const& o) const { return _mm_or_ps(v, o.v); }
+	Mask and_not(Mask const& o) const { return _mm_andnot_ps(o.v, v); }
+	uint32_t lanes() const { return _mm_movemask_ps(v); }
+};
+struct Lanes {
+	static const size_t WIDTH = 4;
+	__m128 v;
+	Lanes(__m128 v_) : v(v_) {}
+	static Lanes load(float const* p) { return _mm_loadu_ps(p); }
+	static Lanes splat(float f) { return _mm_set1_ps(f); }
+	static Lanes select(Mask const& m, Lanes const& a, Lanes const& b) {
+		return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v));
+	}
+	void store(float* p) const { _mm_storeu_ps(p, v); }
+	Lanes operator+(Lanes const& o) const { return _mm_add_ps(v, o.v); }
+	Lanes operator-(Lanes const& o) const { return _mm_sub_ps(v, o.v); }
+	Lanes negated() const { return _mm_xor_ps(v, _mm_set1_ps(-0.0f)); }
+	Mask operator<(Lanes const& o) const { return _mm_cmplt_ps(v, o.v); }
+	Mask operator>(Lanes const& o) const { return _mm_cmpgt_ps(v, o.v); }
+};
+#else
+struct Mask {
+	bool v;
+	Mask(bool v_) : v(v_) {}
+	static Mask bits(uint32_t const* p, uint32_t bit) { return (*p & bit) != 0; }
+	Mask operator&(Mask const& o) const { return v && o.v; }
+	Mask operator|(Mask const& o) const { return v || o.v; }
+	Mask and_not(Mask const& o) const { return v && !o.v; }
+	uint32_t lanes() const { return v; }
+};
+struct Lanes {
+	static const size_t WIDTH = 1;
+	float v;
+	Lanes(float v_) : v(v_) {}
+	static Lanes load(float const* p) { return *p; }
+	static Lanes splat(float f) { return f; }
+	static Lanes select(Mask const& m, Lanes const& a, Lanes const& b) { return m.v ? a : b; }
+	void store(float* p) const { *p = v; }
+	Lanes operator+(Lanes const& o) const { return v + o.v; }
+	Lanes operator-(Lanes const& o) const { return v - o.v; }
+	Lanes negated() const { return -v; }
+	Mask operator<(Lanes const& o) const { return v < o.v; }
+	Mask operator>(Lanes const& o) const { return v > o.v; }
+};
+#endif
+
+const size_t LANES = Lanes::WIDTH;
+// arrays are padded to the widest lanes, so any build steps whole blocks:
+const uint32_t PAD = 8;
+
+VolumeDef const& volume(Level const& level, std::string const& name) {
+	VolumeDef const* def = level.find_volume(name);
+	if (!def)
+		throw std::runtime_error("no volume named " + name + " in level");
+	return *def;
+}
+
+} // namespace
+
+WorldBatch::WorldBatch(Level const& level_, uint32_t count_, uint32_t threads_)
+		: level(level_), count(count_), threads(threads_ ? threads_ : std::max(1U, std::thread::hardware_concurrency())),
+			next(0) {
+	if (level.boxes.size() > 32 || level.items.size() > 32) {
+		throw std::runtime_error("world batches support up to 32 boxes and 32 items");
+	}
+
+	region_boxes.assign(level.regions.size(), 0);
+	uint32_t bridge_name = 0;
+	for (uint32_t b = 0; b < level.boxes.size(); ++b) {
+		BoxDef const& def = level.boxes[b];
+		boxes.emplace_back(def.center, def.radius);
+		region_boxes[def.region] |= 1U << b;
+		if (std::string(level.string(def.name)) == "bridge") {
+			bridge_name = def.name;
+		}
+	}
+	// like Game, every box named as the last "bridge" is, once the bridge is built:
+	for (uint32_t b = 0; b < level.boxes.size(); ++b) {
+		if (bridge_name && level.boxes[b].name == bridge_name) {
+			bridge_boxes |= 1U << b;
+		}
+	}
+
+	for (uint32_t i = 0; i < level.items.size(); ++i) {
+		ItemDef const& def = level.items[i];
+		Item item;
+		item.circle = Circle(def.at, def.reach);
+		item.region = def.region;
+		item.adds = def.adds;
+		item.name = i;
+		for (uint32_t j = 0; j < i; ++j) {
+			if (std::strcmp(level.string(level.items[j].name), level.string(def.name)) == 0) {
+				item.name = j;
+				break;
+			}
+		}
+		item.spawned = (def.flags & ITEM_SPAWNED) != 0;
+		items.emplace_back(item);
+	}
+	auto find_item = [this](std::string const& name) {
+		ItemDef const* def = level.find_item(name);
+		return def ? int32_t(def - &level.items[0]) : int32_t(-1);
+	};
+	apple = find_item("APPLE");
+	coin = find_item("COIN");
+	rock = find_item("ROCK");
+	if (coin == -1 || rock == -1 || !items[coin].spawned || !items[rock].spawned) {
+		throw std::runtime_error("no spawned COIN or ROCK in level");
+	}
+
+	for (VolumeDef const& def : level.volumes) {
+		if (def.accepts) {
+			int32_t accepted = find_item(level.string(def.accepts));
+			if (accepted == -1)
+				throw std::runtime_error("pillar accepts unknown item " + std::string(level.string(def.accepts)));
+			pillar_defs.push_back(Pillar{def.region, Circle(def.center, def.radius), items[accepted].name});
+		}
+	}
+	for (RecipeDef const& def : level.recipes) {
+		uint8_t gives = 0;
+		if (def.result == BRIDGE) {
+			gives = HAS_BRIDGE;
+		} else if (def.result == LONG_KNIFE) {
+			gives = HAS_KNIFE;
+		} else if (def.result == PICKAXE) {
+			gives = HAS_PICKAXE;
+		}
+		recipe_defs.push_back(Recipe{def.needs, gives});
+	}
+	if (pillar_defs.size() > 8 || recipe_defs.size() > 8) {
+		throw std::runtime_error("world batches support up to 8 pillars and 8 recipes");
+	}
+
+	auto as_volume = [this](std::string const& name) {
+		VolumeDef const& def = volume(level, name);
+		return Volume{def.region, Circle(def.center, def.radius)};
+	};
+	tree = as_volume("tree");
+	workbench_volume = as_volume("workbench");
+	hole = as_volume("hole");
+	scale = as_volume("scale");
+
+	uint32_t padded = (count + PAD - 1) / PAD * PAD;
+	at_x.resize(padded);
+	at_y.resize(padded);
+	radius_x.resize(padded);
+	region.resize(padded);
+	held.resize(padded);
+	workbench.resize(padded);
+	solid.resize(padded);
+	gone.resize(padded);
+	spawned.resize(padded);
+	pillars.resize(padded);
+	recipes.resize(padded);
+	flags.resize(padded);
+	prev_buttons.resize(padded);
+	for (uint32_t w = 0; w < padded; ++w) {
+		reset(w);
+	}
+
+	uint32_t chunks = (count + CHUNK - 1) / CHUNK;
+	for (uint32_t i = 1; i < std::min(threads, chunks); ++i) {
+		pool.emplace_back(&WorldBatch::run, this);
+	}
+}
+
+WorldBatch::~WorldBatch() {
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		quit = true;
+	}
+	wake.notify_all();
+	for (std::thread& thread : pool) {
+		thread.join();
+	}
+}
+
+void WorldBatch::reset(uint32_t w) {
+	at_x[w] = level.start_at.x;
+	at_y[w] = level.start_at.y;
+	radius_x[w] = PLAYER_RADIUS.x;
+	held[w] = -1;
+	workbench[w] = 0;
+	gone[w] = 0;
+	spawned[w] = 0;
+	pillars[w] = 0;
+	recipes[w] = 0;
+	flags[w] = 0;
+	prev_buttons[w] = 0;
+	enter_region(w, level.start_region);
+}
+
+std::string WorldBatch::held_name(uint32_t w) const {
+	return held[w] == -1 ? "" : level.string(level.items[held[w]].name);
+}
+
+void WorldBatch::enter_region(uint32_t w, uint32_t to) {
+	region[w] = to;
+	solid[w] = region_boxes[to] & ~((flags[w] & HAS_BRIDGE) ? bridge_boxes : 0);
+}
+
+bool WorldBatch::placed(uint32_t w, uint32_t name) const {
+	for (uint32_t p = 0; p < pillar_defs.size(); ++p) {
+		if ((pillars[w] & (1U << p)) && pillar_defs[p].accepts == name) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// Game::interact, less the hints:
+void WorldBatch::interact(uint32_t w) {
+	glm::vec2 at(at_x[w], at_y[w]);
+	uint32_t here = region[w];
+
+	if (held[w] != -1) {
+		if (here == workbench_volume.region && workbench_volume.circle.contains(at)) {
+			workbench[w] |= items[held[w]].adds;
+			for (uint32_t r = 0; r < recipe_defs.size(); ++r) {
+				if (!(recipes[w] & (1U << r)) && (workbench[w] & recipe_defs[r].needs) == recipe_defs[r].needs) {
+					recipes[w] |= 1U << r;
+					flags[w] |= recipe_defs[r].gives;
+					// the bridge's boxes stop blocking:
+					enter_region(w, here);
+					break;
+				}
+			}
+			gone[w] |= 1U << held[w];
+			held[w] = -1;
+		}
+
+		for (uint32_t p = 0; p < pillar_defs.size(); ++p) {
+			Pillar const& pillar = pillar_defs[p];
+			if (held[w] != -1 && pillar.region == here && items[held[w]].name == pillar.accepts
+					&& pillar.circle.contains(at)) {
+				gone[w] |= 1U << held[w];
+				held[w] = -1;
+				pillars[w] |= 1U << p;
+			}
+		}
+		return;
+	}
+
+	// dig hole
+	if (here == hole.region && !(flags[w] & HOLE_DUG) && hole.circle.contains(at)) {
+		if (flags[w] & HAS_PICKAXE) {
+			spawned[w] |= 1U << coin;
+			flags[w] |= HOLE_DUG;
+		}
+		return;
+	}
+
+	// cut apple (the same one again, should it have gone to the workbench)
+	bool apple_placed = apple != -1 && placed(w, items[apple].name);
+	if (!apple_placed && here == tree.region && (flags[w] & HAS_KNIFE)
+			&& tree.circle.contains(at)) {
+		held[w] = apple;
+		return;
+	}
+
+	// grab from scale (a fresh rock each time)
+	if (!placed(w, items[rock].name) && here == scale.region && scale.circle.contains(at)) {
+		spawned[w] |= 1U << rock;
+		gone[w] &= ~(1U << rock);
+		held[w] = rock;
+		return;
+	}
+
+	// grab items
+	RegionDef const& def = level.regions[here];
+	for (uint32_t i = def.items.first; i < def.items.first + def.items.count; ++i) {
+		bool present = !items[i].spawned || (spawned[w] & (1U << i));
+		if (present && !(gone[w] & (1U << i)) && items[i].circle.contains(at)) {
+			held[w] = i;
+			return;
+		}
+	}
+}
+
+void WorldBatch::step(uint8_t const* buttons) {
+	{
+		std::lock_guard< std::mutex > lock(mutex);
+		pending = buttons;
+		next = 0;
+		busy = uint32_t(pool.size());
+		++generation;
+	}
+	wake.notify_all();
+	work();
+	std::unique_lock< std::mutex > lock(mutex);
+	done.wait(lock, [this]() { return busy == 0; });
+}
+
+void WorldBatch::work() {
+	uint32_t chunks = (count + CHUNK - 1) / CHUNK;
+	for (uint32_t chunk = next++; chunk < chunks; chunk = next++) {
+		step_chunk(chunk);
+	}
+}
+
+void WorldBatch::run() {
+	uint64_t seen = 0;
+	std::unique_lock< std::mutex > lock(mutex);
+	while (true) {
+		wake.wait(lock, [this, seen]() { return quit || generation != seen; });
+		if (quit) {
+			return;
+		}
+		seen = generation;
+		lock.unlock();
+		work();
+		lock.lock();
+		if (--busy == 0) {
+			done.notify_one();
+		}
+	}
+}
+
+void WorldBatch::step_chunk(uint32_t chunk) {
+	uint8_t const* buttons = pending;
+	uint32_t first = chunk * CHUNK;
+	uint32_t last = std::min(first + CHUNK, count);
+
+	// interactions first, from where the player stands before moving:
+	for (uint32_t w = first; w < last; ++w) {
+		if ((buttons[w] & BUTTON_INTERACT) && !(prev_buttons[w] & BUTTON_INTERACT)) {
+			interact(w);
+		}
+		prev_buttons[w] = buttons[w];
+	}
+
+	const Lanes zero = Lanes::splat(0.0f);
+	const Lanes step_x = Lanes::splat(PLAYER_SPEED.x * tick_seconds);
+	const Lanes step_y = Lanes::splat(PLAYER_SPEED.y * tick_seconds);
+	const Lanes radius_y = Lanes::splat(PLAYER_RADIUS.y);
+	const Lanes margin = Lanes::splat(0.25f);
+
+	for (uint32_t w = first; w < last; w += LANES) {
+		uint32_t pressed[LANES];
+		float half_x[LANES], half_y[LANES];
+		for (uint32_t l = 0; l < LANES; ++l) {
+			pressed[l] = w + l < count ? buttons[w + l] : 0;
+			glm::vec2 const& half = level.regions[region[w + l]].radius;
+			half_x[l] = half.x;
+			half_y[l] = half.y;
+		}
+		Mask left = Mask::bits(pressed, BUTTON_LEFT);
+		Mask right = Mask::bits(pressed, BUTTON_RIGHT);
+		Mask up = Mask::bits(pressed, BUTTON_UP);
+		Mask down = Mask::bits(pressed, BUTTON_DOWN);
+
+		// the same operations in the same order as Game::update:
+		Lanes rx = Lanes::load(&radius_x[w]);
+		Lanes dx = Lanes::select(left, zero - step_x, zero);
+		rx = Lanes::select(left & (rx < zero), rx.negated(), rx);
+		dx = Lanes::select(right, dx + step_x, dx);
+		rx = Lanes::select(right & (rx > zero), rx.negated(), rx);
+		Lanes dy = Lanes::select(up, zero + step_y, zero);
+		dy = Lanes::select(down, dy - step_y, dy);
+
+		Lanes ax = Lanes::load(&at_x[w]);
+		Lanes ay = Lanes::load(&at_y[w]);
+		Lanes cx = ax + dx;
+		Lanes cy = ay + dy;
+		Lanes min_x = cx - rx, max_x = cx + rx;
+		Lanes min_y = cy - radius_y, max_y = cy + radius_y;
+
+		Mask hit = zero < zero;
+		for (uint32_t b = 0; b < boxes.size(); ++b) {
+			Mask in = Mask::bits(&solid[w], 1U << b);
+			if (!in.lanes()) {
+				continue;
+			}
+			BoundingBox const& box = boxes[b];
+			hit = hit | (in & (Lanes::splat(box.min.x) < max_x) & (Lanes::splat(box.max.x) > min_x)
+									 & (Lanes::splat(box.min.y) < max_y) & (Lanes::splat(box.max.y) > min_y));
+		}
+		dx = Lanes::select(hit, zero, dx);
+		dy = Lanes::select(hit, zero, dy);
+
+		Lanes hx = Lanes::load(half_x);
+		Lanes hy = Lanes::load(half_y);
+		dy = Lanes::select(min_y < hy.negated(), zero, dy);
+
+		rx.store(&radius_x[w]);
+		(ax + dx).store(&at_x[w]);
+		(ay + dy).store(&at_y[w]);
+
+		// region changes are rare, so done a world at a time:
+		Mask exit_right = max_x > hx - margin;
+		Mask exit_left = (min_x < hx.negated() + margin).and_not(exit_right);
+		uint32_t exits = (exit_right | exit_left).lanes();
+		if (exits) {
+			uint32_t rights = exit_right.lanes();
+			float moved[LANES];
+			dx.store(moved);
+			for (uint32_t l = 0; l < LANES; ++l) {
+				if (!(exits & (1U << l))) {
+					continue;
+				}
+				uint32_t world = w + l;
+				RegionDef const& from = level.regions[region[world]];
+				bool to_right = (rights & (1U << l)) != 0;
+				int32_t to = to_right ? from.right : from.left;
+				if (to == -1) {
+					continue;
+				}
+				enter_region(world, to);
+				float edge = level.regions[to].radius.x;
+				at_x[world] = (to_right ? -edge + 0.25f + radius_x[world] : edge - 0.25f - radius_x[world]) + moved[l];
+			}
+		}
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "level.hpp"
+#include "geometry.hpp"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Many independent playthroughs of a level, stepped together: the rules of Game::update
+ * over structure-of-arrays state, for training agents and load testing. Worlds are
+ * split into chunks that a pool of threads (one per hardware thread) takes in turn.
+ * Within a chunk, interactions (rare: only on the tick C goes down) are handled one
+ * world at a time, then movement, collision against every box of the level and region
+ * changes run several worlds at a time: 8 with AVX2, 4 with SSE2, otherwise one.
+ *
+ * A world ends every tick exactly where Game would, given the same buttons: same
+ * position, region, held item, workbench, tools, pillars and hole. It leaves out what
+ * only the Renderer shows: hints, the camera and the scale's sprite. Spawned items are
+ * picked up in level order rather than spawn order, which only matters if two overlap.
+ * Levels are limited to 32 boxes and 32 items, 8 pillars and 8 recipes.
+ */
+
+struct WorldBatch {
+	// 'threads' 0 means one per hardware thread; throws if the level is over the limits or lacks a volume the rules use:
+	WorldBatch(Level const& level, uint32_t count, uint32_t threads = 0);
+	~WorldBatch();
+	WorldBatch(WorldBatch const&) = delete;
+	WorldBatch& operator=(WorldBatch const&) = delete;
+
+	// advance every world one tick, world w with buttons[w] (Button bits) held:
+	void step(uint8_t const* buttons);
+	// back to the start of the level:
+	void reset(uint32_t world);
+
+	bool won(uint32_t world) const { return !pillar_defs.empty() && pillars[world] == (1U << pillar_defs.size()) - 1; }
+	// held item's name, "" for none:
+	std::string held_name(uint32_t world) const;
+
+	enum Flag : uint8_t {
+		HOLE_DUG = (1 << 0),
+		HAS_BRIDGE = (1 << 1),
+		HAS_PICKAXE = (1 << 2),
+		HAS_KNIFE = (1 << 3),
+	};
+
+	Level const& level;
+	uint32_t count;
+	uint32_t threads;
+	float tick_seconds = 1.0f / 60.0f;
+
+	// per world (padded to a whole number of lanes; the padding never moves):
+	std::vector< float > at_x, at_y;
+	std::vector< float > radius_x; // negative while facing right, as in Game
+	std::vector< uint32_t > region;
+	std::vector< int32_t > held; // index into level.items, -1 for none
+	std::vector< uint32_t > workbench; // Workbench bits
+	std::vector< uint32_t > solid; // boxes that block, bit per index into level.boxes: the region's, less the bridge once built
+	std::vector< uint32_t > gone; // items used up, bit per index into level.items
+	std::vector< uint32_t > spawned; // spawned items that have appeared
+	std::vector< uint8_t > pillars; // filled, bit per pillar
+	std::vector< uint8_t > recipes; // built, bit per recipe
+	std::vector< uint8_t > flags; // Flag bits
+	std::vector< uint8_t > prev_buttons;
+
+	// worlds handed to a thread at a time (a whole number of lanes):
+	static const uint32_t CHUNK = 1024;
+
+private:
+	struct Item {
+		Circle circle;
+		uint32_t region;
+		uint32_t adds;
+		uint32_t name; // index of the first item with this name
+		bool spawned;
+	};
+	struct Pillar {
+		uint32_t region;
+		Circle circle;
+		uint32_t accepts; // as Item::name
+	};
+	struct Recipe {
+		uint32_t needs;
+		uint8_t gives; // Flag
+	};
+	struct Volume {
+		uint32_t region;
+		Circle circle;
+	};
+
+	void interact(uint32_t world);
+	bool placed(uint32_t world, uint32_t name) const;
+	void enter_region(uint32_t world, uint32_t to);
+	void step_chunk(uint32_t chunk);
+	void work();
+	void run();
+
+	std::vector< BoundingBox > boxes;
+	std::vector< Item > items;
+	std::vector< Pillar > pillar_defs;
+	std::vector< Recipe > recipe_defs;
+	Volume tree, workbench_volume, hole, scale;
+	std::vector< uint32_t > region_boxes; // solid bits of each region's boxes
+	uint32_t bridge_boxes = 0;
+	int32_t apple = -1, coin = -1, rock = -1;
+	// as Game's:
+	const glm::vec2 PLAYER_SPEED = glm::vec2(10.0f, 8.5f);
+	const glm::vec2 PLAYER_RADIUS = glm::vec2(0.5f, 1.0f);
+
+	// the pool waits for step() to bump 'generation', then takes chunks from 'next' until none are left:
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable done;
+	uint64_t generation = 0;
+	uint32_t busy = 0;
+	bool quit = false;
+	uint8_t const* pending = nullptr;
+	std::atomic< uint32_t > next;
+	std::vector< std::thread > pool;
+};
@@ -0,0 +1,191 @@
+#include "config.hpp"
+#include "level.hpp"
+#include "region_streamer.hpp"
+#include "game.hpp"
+#include "bot.hpp"
+#include "world_batch.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+ * Checks WorldBatch against Game, then measures its throughput. The check steps a small
+ * batch alongside a Game per world: world 0 gets the buttons of a Bot playing the whole
+ * puzzle, the rest random ones, and every world must match its Game after every tick.
+ * Then a large batch steps with random buttons (changed now and then, so players wander
+ * and interact), and the time spent in WorldBatch::step gives world-steps per second.
+ * Run from the repository root: dist/worlds [--worlds N] [--ticks T] [--threads N] [--json file]
+ *  --threads defaults to one per hardware thread.
+ *  --json writes the throughput to 'file' as well, as a JSON object.
+ */
+
+namespace {
+
+const float DT = 1.0f / 60.0f;
+const uint32_t WORLDS = 100000;
+const uint32_t TICKS = 1000;
+const uint32_t CHECKED = 64; // worlds checked against Game
+const uint32_t CHANGE = 16; // random buttons change about once every this many ticks
+
+// xorshift32, so runs are repeatable:
+struct Random {
+	uint32_t state;
+	explicit Random(uint32_t seed) : state(seed ? seed : 1) {}
+	uint32_t next() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+};
+
+// a random walk: mostly holding a direction or two, sometimes interacting:
+void wander(Random& random, std::vector< uint8_t >* buttons) {
+	for (uint8_t& b : *buttons) {
+		uint32_t r = random.next();
+		if (r % CHANGE == 0) {
+			b = uint8_t((r >> 8) & (BUTTON_LEFT | BUTTON_RIGHT | BUTTON_UP | BUTTON_DOWN | BUTTON_INTERACT));
+		}
+	}
+}
+
+// "" if world 'w' is where 'game' is, otherwise what differs:
+std::string compare(Game const& game, WorldBatch const& batch, uint32_t w) {
+	std::ostringstream differs;
+	if (game.player.at.x != batch.at_x[w] || game.player.at.y != batch.at_y[w]) {
+		differs << " at " << batch.at_x[w] << ", " << batch.at_y[w] << " rather than " << game.player.at.x << ", "
+						<< game.player.at.y << ";";
+	}
+	if (game.player.radius.x != batch.radius_x[w]) {
+		differs << " facing the other way;";
+	}
+	if (game.currentMap != batch.region[w]) {
+		differs << " in region " << batch.region[w] << " rather than " << game.currentMap << ";";
+	}
+	std::string held = game.playerItem ? game.playerItem->name : "";
+	if (held != batch.held_name(w)) {
+		differs << " holding '" << batch.held_name(w) << "' rather than '" << held << "';";
+	}
+	if (uint32_t(game.workbenchState) != batch.workbench[w]) {
+		differs << " workbench " << batch.workbench[w] << " rather than " << uint32_t(game.workbenchState) << ";";
+	}
+	uint8_t flags = (game.holeDug ? WorldBatch::HOLE_DUG : 0) | (game.hasBridge ? WorldBatch::HAS_BRIDGE : 0)
+			| (game.hasPickaxe ? WorldBatch::HAS_PICKAXE : 0) | (game.hasKnife ? WorldBatch::HAS_KNIFE : 0);
+	if (flags != batch.flags[w]) {
+		differs << " flags " << uint32_t(batch.flags[w]) << " rather than " << uint32_t(flags) << ";";
+	}
+	uint8_t pillars = 0;
+	for (uint32_t p = 0; p < game.pillars.size(); ++p) {
+		pillars |= game.pillars[p].filled ? 1U << p : 0;
+	}
+	if (pillars != batch.pillars[w]) {
+		differs << " pillars " << uint32_t(batch.pillars[w]) << " rather than " << uint32_t(pillars) << ";";
+	}
+	return differs.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	uint32_t worlds = WORLDS;
+	uint32_t ticks = TICKS;
+	uint32_t threads = 0;
+	std::string json;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg == "--worlds" && i + 1 < argc) {
+			worlds = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--ticks" && i + 1 < argc) {
+			ticks = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--threads" && i + 1 < argc) {
+			threads = std::strtoul(argv[++i], nullptr, 10);
+		} else if (arg == "--json" && i + 1 < argc) {
+			json = argv[++i];
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--worlds N] [--ticks T] [--threads N] [--json file]" << std::endl;
+			return 1;
+		}
+	}
+
+	Config config;
+	Level level;
+	if (!load_level(config.level, &level)) {
+		std::cerr << "Failed to load level." << std::endl;
+		return 1;
+	}
+	// Game needs these for its sprites:
+	for (uint32_t p = 0; p < config.atlas_pages.size(); ++p) {
+		if (!load_sprite_info(config.atlas_pages[p] + ".file", p)) {
+			return 1;
+		}
+	}
+
+	// play along with Game:
+	{
+		RegionStreamer streamer(level, "", config.region_budget);
+		std::vector< std::unique_ptr< Game > > games;
+		for (uint32_t w = 0; w < CHECKED; ++w) {
+			games.emplace_back(new Game(level, &streamer));
+		}
+		Bot bot(*games[0], DT);
+		WorldBatch batch(level, CHECKED, threads);
+		batch.tick_seconds = DT;
+
+		Random random(1);
+		std::vector< uint8_t > buttons(CHECKED, 0);
+		uint32_t tick = 0;
+		for (; !bot.finished(); ++tick) {
+			wander(random, &buttons);
+			buttons[0] = bot.buttons();
+			batch.step(&buttons[0]);
+			for (uint32_t w = 0; w < CHECKED; ++w) {
+				games[w]->update(buttons[w], DT);
+				std::string differs = compare(*games[w], batch, w);
+				if (!differs.empty()) {
+					std::cerr << "World " << w << " differs from Game on tick " << tick << ":" << differs << std::endl;
+					return 1;
+				}
+			}
+		}
+		if (!batch.won(0)) {
+			std::cerr << "World 0 didn't win with the bot's buttons." << std::endl;
+			return 1;
+		}
+		std::cout << "Matched Game for " << tick << " ticks in " << CHECKED << " worlds (world 0 playing to the win)."
+							<< std::endl;
+	}
+
+	WorldBatch batch(level, worlds, threads);
+	batch.tick_seconds = DT;
+	Random random(2);
+	std::vector< uint8_t > buttons(worlds, 0);
+	double seconds = 0.0;
+	for (uint32_t t = 0; t < ticks; ++t) {
+		wander(random, &buttons);
+		auto start = std::chrono::high_resolution_clock::now();
+		batch.step(&buttons[0]);
+		seconds += std::chrono::duration< double >(std::chrono::high_resolution_clock::now() - start).count();
+	}
+
+	double steps = double(worlds) * ticks;
+	std::cout << "Stepped " << worlds << " worlds " << ticks << " ticks on " << batch.threads << " threads in " << seconds
+						<< " s: " << steps / seconds << " world-steps/s, " << seconds / steps * 1e9 << " ns per world-step."
+						<< std::endl;
+
+	if (!json.empty()) {
+		std::ofstream file(json);
+		file << "{\"worlds\": " << worlds << ", \"ticks\": " << ticks << ", \"threads\": " << batch.threads
+				 << ", \"world_steps_per_second\": " << steps / seconds << "}\n";
+		if (!file) {
+			std::cerr << "Failed to write '" << json << "'" << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}